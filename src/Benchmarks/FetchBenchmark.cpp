@@ -0,0 +1,150 @@
+// Fetches opcodes along a recorded stream of PCs, once through a page table like Memory::operator[] and once through the block cache.
+// Nothing else of the CPU runs, so this is the fetch/decode cost on its own. The checksums of both variants have to match.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "Allocator.h"
+#include "BlockCache.h"
+#include "InstructionTable.h"
+
+#define ROM_SIZE 0x8000
+#define PAGE_SIZE 0x100
+#define PAGE_COUNT (ROM_SIZE / PAGE_SIZE)
+#define HOT_TARGET_COUNT 64
+#define TRACE_LENGTH 1000000
+#define DEFAULT_PASS_COUNT 200
+
+namespace
+{
+#define FETCH_BENCHMARK_LENGTH_ENTRY(opcode, mnemonic, length, duration, func) length,
+	const uint8_t s_lengths[] = { INSTRUCTION_TABLE(FETCH_BENCHMARK_LENGTH_ENTRY) };
+#undef FETCH_BENCHMARK_LENGTH_ENTRY
+
+	uint32_t NextRandom(uint32_t& state)
+	{
+		// xorshift32
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	bool IsControlFlow(uint8_t opcode)
+	{
+		switch (opcode)
+		{
+		case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+		case 0xC2: case 0xC3: case 0xCA: case 0xD2: case 0xDA: case 0xE9:
+		case 0xC4: case 0xCC: case 0xCD: case 0xD4: case 0xDC:
+		case 0xC0: case 0xC8: case 0xC9: case 0xD0: case 0xD8: case 0xD9:
+		case 0x10: case 0x76:
+			return true;
+		default:
+			return (opcode & 0xC7) == 0xC7;
+		}
+	}
+
+	// Random code, control flow jumps to one of a few hot spots the way loops & subroutines keep coming back to the same code
+	void GenerateTrace(std::vector<uint8_t>& rom, std::vector<uint16_t>& trace)
+	{
+		uint32_t random = 0x12345678;
+		for (uint8_t& byte : rom)
+		{
+			byte = static_cast<uint8_t>(NextRandom(random));
+		}
+
+		uint16_t hotTargets[HOT_TARGET_COUNT];
+		for (uint16_t& target : hotTargets)
+		{
+			target = static_cast<uint16_t>(NextRandom(random) % ROM_SIZE);
+		}
+
+		uint32_t pc = hotTargets[0];
+		while (trace.size() < TRACE_LENGTH)
+		{
+			uint8_t opcode = rom[pc];
+			trace.push_back(static_cast<uint16_t>(pc));
+			if (opcode == 0xCB)
+			{
+				trace.push_back(static_cast<uint16_t>((pc + 1) % ROM_SIZE));
+				pc += 2;
+			}
+			else if (IsControlFlow(opcode))
+			{
+				pc = hotTargets[NextRandom(random) % HOT_TARGET_COUNT];
+			}
+			else
+			{
+				pc += s_lengths[opcode];
+			}
+			pc %= ROM_SIZE;
+		}
+	}
+
+	void* Alloc(uint32_t size)
+	{
+		return malloc(size);
+	}
+
+	void Free(void* ptr)
+	{
+		free(ptr);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	uint32_t passCount = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : DEFAULT_PASS_COUNT;
+
+	std::vector<uint8_t> rom(ROM_SIZE);
+	std::vector<uint16_t> trace;
+	trace.reserve(TRACE_LENGTH + 1);
+	GenerateTrace(rom, trace);
+
+	const uint8_t* pages[PAGE_COUNT];
+	Allocator* allocator = Allocator::Create(Alloc, Free);
+	BlockCache* blockCache = Y_NEW(allocator, BlockCache, allocator);
+	for (uint32_t page = 0; page < PAGE_COUNT; ++page)
+	{
+		pages[page] = rom.data() + page * PAGE_SIZE;
+		blockCache->MapPage(page, pages[page]);
+	}
+
+	uint64_t pageTableChecksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t pass = 0; pass < passCount; ++pass)
+	{
+		for (uint16_t pc : trace)
+		{
+			const uint8_t* page = pages[pc >> 8];
+			uint8_t opcode = page != nullptr ? page[pc & (PAGE_SIZE - 1)] : 0xFF;
+			pageTableChecksum = pageTableChecksum * 31 + opcode;
+		}
+	}
+	auto middle = std::chrono::steady_clock::now();
+
+	uint64_t blockCacheChecksum = 0;
+	for (uint32_t pass = 0; pass < passCount; ++pass)
+	{
+		for (uint16_t pc : trace)
+		{
+			const BlockCache::Instruction* instruction = blockCache->Fetch(pc);
+			uint8_t opcode = instruction != nullptr ? instruction->m_opcode : 0xFF;
+			blockCacheChecksum = blockCacheChecksum * 31 + opcode;
+		}
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	Y_DELETE(allocator, blockCache);
+	Allocator::Destroy(allocator);
+
+	double fetchCount = static_cast<double>(trace.size()) * passCount;
+	double pageTableSeconds = std::chrono::duration<double>(middle - start).count();
+	double blockCacheSeconds = std::chrono::duration<double>(end - middle).count();
+	printf("Fetches:          %.0f\n", fetchCount);
+	printf("Page table:       %.3f s, %.2f ns/fetch\n", pageTableSeconds, pageTableSeconds * 1000000000.0 / fetchCount);
+	printf("Block cache:      %.3f s, %.2f ns/fetch\n", blockCacheSeconds, blockCacheSeconds * 1000000000.0 / fetchCount);
+	printf("Checksums:        %016llx %016llx\n", static_cast<unsigned long long>(pageTableChecksum), static_cast<unsigned long long>(blockCacheChecksum));
+	return 0;
+}
@@ -0,0 +1,138 @@
+// Pushes, merges & pops pixels the way the PPU does over a scanline, without anything else of the emulator.
+// Build with PIXEL_FIFO_BITPLANES set to 0 or 1 to compare both FIFO variants, the checksums have to match.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "PixelFIFO.h"
+
+#define SCREEN_WIDTH 160
+#define SPRITES_PER_LINE 10
+#define BACKGROUND_ROWS_PER_LINE (SCREEN_WIDTH / PIXEL_FIFO_ROW_SIZE + 1)
+#define LINE_TEMPLATE_COUNT 1024
+#define DEFAULT_LINE_COUNT 2000000
+
+namespace
+{
+	struct SpriteRow
+	{
+		uint8_t m_x;
+		uint8_t m_low;
+		uint8_t m_high;
+		uint8_t m_offscreenX;
+		bool m_isOddPosition;
+		bool m_palette;
+		bool m_backgroundPriority;
+	};
+
+	// Random tile data & sprites, generated up front so only the FIFOs are measured
+	struct LineTemplate
+	{
+		uint8_t m_backgroundRows[BACKGROUND_ROWS_PER_LINE][2];
+		SpriteRow m_sprites[SPRITES_PER_LINE];
+	};
+
+	uint32_t NextRandom(uint32_t& state)
+	{
+		// xorshift32
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	void GenerateTemplates(std::vector<LineTemplate>& templates)
+	{
+		uint32_t random = 0x12345678;
+		for (LineTemplate& line : templates)
+		{
+			for (uint32_t i = 0; i < BACKGROUND_ROWS_PER_LINE; ++i)
+			{
+				uint32_t row = NextRandom(random);
+				line.m_backgroundRows[i][0] = static_cast<uint8_t>(row);
+				line.m_backgroundRows[i][1] = static_cast<uint8_t>(row >> 8);
+			}
+			for (SpriteRow& sprite : line.m_sprites)
+			{
+				uint32_t row = NextRandom(random);
+				sprite.m_x = static_cast<uint8_t>(NextRandom(random) % SCREEN_WIDTH);
+				sprite.m_low = static_cast<uint8_t>(row);
+				sprite.m_high = static_cast<uint8_t>(row >> 8);
+				sprite.m_isOddPosition = (row & 0x10000) > 0;
+				sprite.m_offscreenX = (row >> 17) % 4 == 0 ? static_cast<uint8_t>((row >> 19) % PIXEL_FIFO_ROW_SIZE) : 0;
+				sprite.m_palette = (row & 0x400000) > 0;
+				sprite.m_backgroundPriority = (row & 0x800000) > 0;
+			}
+			std::sort(line.m_sprites, line.m_sprites + SPRITES_PER_LINE, [](const SpriteRow& a, const SpriteRow& b) { return a.m_x < b.m_x; });
+		}
+	}
+
+	uint64_t DrawLine(PixelFIFO& background, PixelFIFO& sprites, const LineTemplate& line)
+	{
+		background.Clear();
+		sprites.Clear();
+
+		uint64_t checksum = 0;
+		uint32_t nextRow = 0;
+		uint32_t nextSprite = 0;
+		for (uint32_t x = 0; x < SCREEN_WIDTH; ++x)
+		{
+			if (background.Size() <= PIXEL_FIFO_ROW_SIZE)
+			{
+				background.PushRow(line.m_backgroundRows[nextRow][0], line.m_backgroundRows[nextRow][1]);
+				nextRow++;
+			}
+
+			while (nextSprite < SPRITES_PER_LINE && line.m_sprites[nextSprite].m_x == x)
+			{
+				const SpriteRow& sprite = line.m_sprites[nextSprite++];
+				if (sprite.m_isOddPosition && sprite.m_offscreenX == 0)
+				{
+					sprites.PushTransparent();
+				}
+				sprites.MergeRow(sprite.m_isOddPosition ? 1 : 0, static_cast<uint8_t>(sprite.m_low << sprite.m_offscreenX), static_cast<uint8_t>(sprite.m_high << sprite.m_offscreenX),
+					PIXEL_FIFO_ROW_SIZE - sprite.m_offscreenX, sprite.m_palette, sprite.m_backgroundPriority);
+			}
+
+			Pixel pixel = background.Pop();
+			if (sprites.Size() > 0)
+			{
+				Pixel spritePixel = sprites.Pop();
+				if (spritePixel.m_color != 0 && (!spritePixel.m_backgroundPriority || pixel.m_color == 0))
+				{
+					pixel = spritePixel;
+				}
+			}
+			checksum = checksum * 31 + pixel.m_color + pixel.m_palette * 4;
+		}
+		return checksum;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	uint32_t lineCount = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : DEFAULT_LINE_COUNT;
+
+	std::vector<LineTemplate> templates(LINE_TEMPLATE_COUNT);
+	GenerateTemplates(templates);
+
+	PixelFIFO background;
+	PixelFIFO sprites;
+	uint64_t checksum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < lineCount; ++i)
+	{
+		checksum ^= DrawLine(background, sprites, templates[i % LINE_TEMPLATE_COUNT]) + i;
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	double hostSeconds = std::chrono::duration<double>(end - start).count();
+	printf("FIFO:             %s\n", PIXEL_FIFO_BITPLANES ? "bitplanes" : "ring buffer");
+	printf("Lines:            %u\n", lineCount);
+	printf("Host time:        %.3f s\n", hostSeconds);
+	printf("Host ns/line:     %.1f\n", hostSeconds * 1000000000.0 / lineCount);
+	printf("Checksum:         %016llx\n", static_cast<unsigned long long>(checksum));
+	return 0;
+}
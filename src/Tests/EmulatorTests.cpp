@@ -0,0 +1,535 @@
+#include <memory>
+#include "gtest/gtest.h"
+#include "FileHelper.h"
+#include "VirtualMachine.h"
+#include "OAMScan.h"
+#include "BandLimitedSynth.h"
+#include "Timer.h"
+
+#define SPLASH_PATH "../../../splash.gb"
+
+void* InstanceAllocFunc(uint32_t size)
+{
+    return new uint8_t[size];
+}
+
+void InstanceFreeFunc(void* ptr)
+{
+    delete[] reinterpret_cast<uint8_t*>(ptr);
+}
+
+uint64_t HashFrame(const void* frameBuffer)
+{
+    // FNV-1a
+    const uint8_t* bytes = static_cast<const uint8_t*>(frameBuffer);
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t i = 0; i < EmulatorConstants::SCREEN_SIZE * 4; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+Emulator* CreateSplashEmulator(std::vector<char>& romBlob)
+{
+    Emulator* emu = Emulator::Create(InstanceAllocFunc, InstanceFreeFunc);
+    emu->Load(SPLASH_PATH, romBlob.data(), static_cast<uint32_t>(romBlob.size()));
+    return emu;
+}
+
+TEST(MultiInstanceTest, IndependentLifetimes)
+{
+    std::vector<char> romBlob;
+    if (!FileParser::Read(SPLASH_PATH, romBlob))
+    {
+        FAIL();
+    }
+
+    EmulatorInputs::InputState inputState;
+
+    Emulator* first = CreateSplashEmulator(romBlob);
+    first->Step(inputState, 16.67, false);
+
+    // Creating and deleting another instance must not touch the memory of the first one
+    Emulator* temporary = CreateSplashEmulator(romBlob);
+    temporary->Step(inputState, 16.67, false);
+    Emulator::Delete(temporary);
+
+    Emulator* second = CreateSplashEmulator(romBlob);
+    second->Step(inputState, 16.67, false);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        first->Step(inputState, 16.67, false);
+        second->Step(inputState, 16.67, false);
+    }
+
+    SerializationView firstState = first->Serialize(false);
+    SerializationView secondState = second->Serialize(false);
+
+    ASSERT_EQ(firstState.size, secondState.size);
+    EXPECT_TRUE(memcmp(firstState.data, secondState.data, firstState.size) == 0);
+    EXPECT_TRUE(memcmp(first->GetFrameBuffer(), second->GetFrameBuffer(), EmulatorConstants::SCREEN_SIZE * 4) == 0);
+    EXPECT_NE(first->GetFrameBuffer(), second->GetFrameBuffer());
+
+    Emulator::Delete(first);
+    Emulator::Delete(second);
+}
+
+TEST(CycleSteppingTest, RunUntilVBlankStopsAtFrameBoundaries)
+{
+    std::vector<char> romBlob;
+    if (!FileParser::Read(SPLASH_PATH, romBlob))
+    {
+        FAIL();
+    }
+
+    EmulatorInputs::InputState inputState;
+    Emulator* emu = CreateSplashEmulator(romBlob);
+
+    // The splash screen toggles the LCD while it sets up, VBlanks are a frame apart once it keeps running
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_LE(emu->RunUntilVBlank(inputState), EmulatorConstants::TCYCLES_PER_FRAME);
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(emu->RunUntilVBlank(inputState), EmulatorConstants::TCYCLES_PER_FRAME);
+    }
+
+    Emulator::Delete(emu);
+}
+
+TEST(CycleSteppingTest, RunCyclesIsIndependentOfChunking)
+{
+    std::vector<char> romBlob;
+    if (!FileParser::Read(SPLASH_PATH, romBlob))
+    {
+        FAIL();
+    }
+
+    EmulatorInputs::InputState inputState;
+    Emulator* first = CreateSplashEmulator(romBlob);
+    Emulator* second = CreateSplashEmulator(romBlob);
+
+    const uint64_t totalCycles = EmulatorConstants::TCYCLES_PER_FRAME * 10;
+    EXPECT_EQ(first->RunCycles(inputState, totalCycles), totalCycles);
+
+    uint64_t cyclesRun = 0;
+    while (cyclesRun < totalCycles)
+    {
+        uint64_t chunk = totalCycles - cyclesRun < 1000 ? totalCycles - cyclesRun : 1000;
+        cyclesRun += second->RunCycles(inputState, chunk);
+    }
+    EXPECT_EQ(cyclesRun, totalCycles);
+
+    SerializationView firstState = first->Serialize(false);
+    SerializationView secondState = second->Serialize(false);
+
+    ASSERT_EQ(firstState.size, secondState.size);
+    EXPECT_TRUE(memcmp(firstState.data, secondState.data, firstState.size) == 0);
+
+    Emulator::Delete(first);
+    Emulator::Delete(second);
+}
+
+TEST(ScanlineRendererTest, FramesMatchPixelFIFO)
+{
+    std::vector<char> romBlob;
+    if (!FileParser::Read(SPLASH_PATH, romBlob))
+    {
+        FAIL();
+    }
+
+    EmulatorInputs::InputState inputState;
+    Emulator* reference = CreateSplashEmulator(romBlob);
+    Emulator* scanline = CreateSplashEmulator(romBlob);
+    scanline->SetPPUAccuracy(EmulatorSettings::PPUAccuracy::Scanline);
+
+    // Hashing every frame also covers the ones in which the splash screen scrolls in
+    for (int i = 0; i < 120; ++i)
+    {
+        EXPECT_EQ(reference->RunUntilVBlank(inputState), scanline->RunUntilVBlank(inputState));
+        EXPECT_EQ(HashFrame(reference->GetFrameBuffer()), HashFrame(scanline->GetFrameBuffer())) << "frame " << i;
+    }
+
+    Emulator::Delete(reference);
+    Emulator::Delete(scanline);
+}
+
+struct FrameReadyCounter
+{
+    const void* m_lastFrame = nullptr;
+    uint32_t m_count = 0;
+};
+
+void CountFrame(const void* frameBuffer, void* userData)
+{
+    FrameReadyCounter* counter = static_cast<FrameReadyCounter*>(userData);
+    counter->m_lastFrame = frameBuffer;
+    counter->m_count++;
+}
+
+TEST(FrameBufferTest, ExternalTargetsMatchInternalFrames)
+{
+    std::vector<char> romBlob;
+    if (!FileParser::Read(SPLASH_PATH, romBlob))
+    {
+        FAIL();
+    }
+
+    const uint32_t width = EmulatorConstants::SCREEN_WIDTH;
+    const uint32_t height = EmulatorConstants::SCREEN_HEIGHT;
+
+    EmulatorInputs::InputState inputState;
+    Emulator* reference = CreateSplashEmulator(romBlob);
+    Emulator* rgba = CreateSplashEmulator(romBlob);
+    Emulator* indexed = CreateSplashEmulator(romBlob);
+    Emulator* packed = CreateSplashEmulator(romBlob);
+
+    // Padded strides, the bytes in between lines must stay untouched
+    const uint32_t rgbaStride = (width + 8) * 4;
+    std::vector<uint8_t> rgbaFrame(rgbaStride * height, 0xAB);
+    rgba->SetFrameBuffer(rgbaFrame.data(), rgbaStride, EmulatorSettings::PixelFormat::RGBA8888);
+    std::vector<uint8_t> indexedFrame(width * height);
+    indexed->SetFrameBuffer(indexedFrame.data(), width, EmulatorSettings::PixelFormat::Indexed8);
+    const uint32_t packedStride = width / 4 + 2;
+    std::vector<uint8_t> packedFrame(packedStride * height);
+    packed->SetFrameBuffer(packedFrame.data(), packedStride, EmulatorSettings::PixelFormat::Packed2bpp);
+
+    FrameReadyCounter counter;
+    rgba->SetFrameReadyCallback(CountFrame, &counter);
+
+    // A stride that can't hold a line is rejected
+    indexed->SetFrameBuffer(indexedFrame.data(), width - 1, EmulatorSettings::PixelFormat::Indexed8);
+    EXPECT_EQ(indexed->GetFrameBuffer(), indexedFrame.data());
+
+    // Skip the frames in which the splash screen toggles the LCD
+    for (int i = 0; i < 60; ++i)
+    {
+        reference->RunUntilVBlank(inputState);
+        rgba->RunUntilVBlank(inputState);
+        indexed->RunUntilVBlank(inputState);
+        packed->RunUntilVBlank(inputState);
+    }
+    EXPECT_GT(counter.m_count, 0u);
+    EXPECT_EQ(counter.m_lastFrame, rgbaFrame.data());
+
+    const uint8_t* referenceFrame = static_cast<const uint8_t*>(reference->GetFrameBuffer());
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        ASSERT_EQ(memcmp(referenceFrame + y * width * 4, rgbaFrame.data() + y * rgbaStride, width * 4), 0) << "line " << y;
+        EXPECT_EQ(rgbaFrame[y * rgbaStride + width * 4], 0xAB);
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            uint8_t shade = indexedFrame[y * width + x];
+            ASSERT_LT(shade, 4);
+            EXPECT_EQ((packedFrame[y * packedStride + x / 4] >> ((3 - x % 4) * 2)) & 0x3, shade);
+            // Darker shades have a smaller red component
+            if (x > 0 && shade != indexedFrame[y * width + x - 1])
+            {
+                EXPECT_EQ(shade > indexedFrame[y * width + x - 1], referenceFrame[(y * width + x) * 4] < referenceFrame[(y * width + x - 1) * 4]);
+            }
+        }
+    }
+
+    // Back to the internal frames
+    rgba->SetFrameBuffer(nullptr, 0, EmulatorSettings::PixelFormat::RGBA8888);
+    rgba->RunUntilVBlank(inputState);
+    reference->RunUntilVBlank(inputState);
+    EXPECT_NE(rgba->GetFrameBuffer(), rgbaFrame.data());
+    EXPECT_EQ(HashFrame(reference->GetFrameBuffer()), HashFrame(rgba->GetFrameBuffer()));
+
+    Emulator::Delete(reference);
+    Emulator::Delete(rgba);
+    Emulator::Delete(indexed);
+    Emulator::Delete(packed);
+}
+
+void HashReadyFrame(const void* frameBuffer, void* userData)
+{
+    static_cast<std::vector<uint64_t>*>(userData)->push_back(HashFrame(frameBuffer));
+}
+
+TEST(RenderIntervalTest, SkippedFramesKeepTiming)
+{
+    std::vector<char> romBlob;
+    if (!FileParser::Read(SPLASH_PATH, romBlob))
+    {
+        FAIL();
+    }
+
+    EmulatorInputs::InputState inputState;
+    Emulator* reference = CreateSplashEmulator(romBlob);
+    Emulator* skipping = CreateSplashEmulator(romBlob);
+    skipping->SetRenderInterval(3);
+
+    std::vector<uint64_t> referenceFrames;
+    std::vector<uint64_t> drawnFrames;
+    reference->SetFrameReadyCallback(HashReadyFrame, &referenceFrames);
+    skipping->SetFrameReadyCallback(HashReadyFrame, &drawnFrames);
+
+    for (int i = 0; i < 120; ++i)
+    {
+        EXPECT_EQ(reference->RunUntilVBlank(inputState), skipping->RunUntilVBlank(inputState));
+    }
+
+    // Only every third frame is drawn, and those are the same as without skipping
+    ASSERT_EQ(drawnFrames.size(), (referenceFrames.size() + 2) / 3);
+    for (size_t i = 0; i < drawnFrames.size(); ++i)
+    {
+        EXPECT_EQ(drawnFrames[i], referenceFrames[i * 3]) << "frame " << i * 3;
+    }
+
+    Emulator::Delete(reference);
+    Emulator::Delete(skipping);
+}
+
+TEST(PollingLoopTest, SkippedCyclesAreCounted)
+{
+    std::vector<char> romBlob;
+    if (!FileParser::Read(SPLASH_PATH, romBlob))
+    {
+        FAIL();
+    }
+
+    EmulatorInputs::InputState inputState;
+    Emulator* emu = CreateSplashEmulator(romBlob);
+    EXPECT_EQ(emu->GetSkippedPollingCycles(), 0u);
+
+    // The splash screen spends part of its frames spinning in polling loops, which get fast-forwarded
+    const uint64_t totalCycles = EmulatorConstants::TCYCLES_PER_FRAME * 60;
+    EXPECT_EQ(emu->RunCycles(inputState, totalCycles), totalCycles);
+    EXPECT_GT(emu->GetSkippedPollingCycles(), 0u);
+    EXPECT_LT(emu->GetSkippedPollingCycles(), totalCycles);
+
+    Emulator::Delete(emu);
+}
+
+TEST(AudioOffTest, NoSamplesWithSameEmulation)
+{
+    std::vector<char> romBlob;
+    if (!FileParser::Read(SPLASH_PATH, romBlob))
+    {
+        FAIL();
+    }
+
+    const uint32_t bufferSize = 4096;
+    std::vector<float> referenceBuffer(bufferSize, 0.0f);
+    std::vector<float> mutedBuffer(bufferSize, 0.0f);
+    uint32_t referencePosition = 0;
+    uint32_t mutedPosition = 0;
+
+    EmulatorInputs::InputState inputState;
+    Emulator* reference = CreateSplashEmulator(romBlob);
+    Emulator* muted = CreateSplashEmulator(romBlob);
+    reference->SetAudioBuffer(referenceBuffer.data(), bufferSize, 44100, &referencePosition);
+    muted->SetAudioBuffer(mutedBuffer.data(), bufferSize, 44100, &mutedPosition);
+    muted->SetAudioEnabled(false);
+
+    std::vector<uint64_t> referenceFrames;
+    std::vector<uint64_t> mutedFrames;
+    reference->SetFrameReadyCallback(HashReadyFrame, &referenceFrames);
+    muted->SetFrameReadyCallback(HashReadyFrame, &mutedFrames);
+
+    for (int i = 0; i < 60; ++i)
+    {
+        EXPECT_EQ(reference->RunUntilVBlank(inputState), muted->RunUntilVBlank(inputState));
+        EXPECT_GT(reference->GetNumberOfGeneratedSamples(), 0u);
+        EXPECT_EQ(muted->GetNumberOfGeneratedSamples(), 0u);
+    }
+    EXPECT_EQ(referenceFrames, mutedFrames);
+    EXPECT_EQ(mutedPosition, 0u);
+    for (uint32_t i = 0; i < bufferSize; ++i)
+    {
+        ASSERT_EQ(mutedBuffer[i], 0.0f) << "sample " << i;
+    }
+
+    // Turned back on, it picks up where the reference is
+    muted->SetAudioEnabled(true);
+    EXPECT_EQ(reference->RunUntilVBlank(inputState), muted->RunUntilVBlank(inputState));
+    EXPECT_EQ(muted->GetNumberOfGeneratedSamples(), reference->GetNumberOfGeneratedSamples());
+
+    Emulator::Delete(reference);
+    Emulator::Delete(muted);
+}
+
+TEST(OAMScanTest, MatchesScanningOneEntryAtATime)
+{
+    uint8_t oam[OAM_ENTRY_COUNT * OAM_ENTRY_SIZE];
+    uint32_t seed = 12345;
+    for (int round = 0; round < 64; ++round)
+    {
+        // Y positions around the visible lines, including the ones that wrap around
+        for (uint32_t i = 0; i < sizeof(oam); ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            oam[i] = static_cast<uint8_t>(i % OAM_ENTRY_SIZE == 0 ? (seed >> 24) % 180 + (round % 4 == 0 ? 76 : 0) : seed >> 24);
+        }
+
+        for (uint32_t lineY = 0; lineY < 154; ++lineY)
+        {
+            for (int doubleSize = 0; doubleSize < 2; ++doubleSize)
+            {
+                uint64_t expected = 0;
+                for (uint32_t entry = 0; entry < OAM_ENTRY_COUNT; ++entry)
+                {
+                    uint32_t posY = oam[entry * OAM_ENTRY_SIZE];
+                    if (lineY + (doubleSize ? 0 : 8) < posY && lineY + 16 >= posY)
+                    {
+                        expected |= 1ull << entry;
+                    }
+                }
+                ASSERT_EQ(OAMScan::FindSpritesInLine(oam, static_cast<uint8_t>(lineY), doubleSize != 0), expected) << "line " << lineY;
+                ASSERT_EQ(OAMScan::FindSpritesInLineScalar(oam, static_cast<uint8_t>(lineY), doubleSize != 0), expected) << "line " << lineY;
+            }
+        }
+    }
+}
+
+TEST(BandLimitedSynthTest, StepsSettleAtTheirHeight)
+{
+    std::unique_ptr<BandLimitedSynth> synth(new BandLimitedSynth());
+    synth->SetRates(CPU_FREQUENCY, 48000);
+
+    // Without a cutoff the filter passes everything, the output is the plain sum of the steps
+    HighPassFilter left;
+    HighPassFilter right;
+    left.SetParams(0.0f, 48000.0f);
+    right.SetParams(0.0f, 48000.0f);
+
+    synth->AddDelta(37, 1.0f, -0.5f);
+    synth->EndBlock(4096);
+
+    const uint32_t count = synth->GetAvailableSamples();
+    ASSERT_GT(count, static_cast<uint32_t>(BAND_LIMITED_SYNTH_TAPS));
+
+    std::vector<float> out(count * 2);
+    synth->ReadSamples(out.data(), count, left, right);
+    for (uint32_t i = BAND_LIMITED_SYNTH_TAPS; i < count; ++i)
+    {
+        EXPECT_NEAR(out[i * 2], 1.0f, 1e-4f) << "sample " << i;
+        EXPECT_NEAR(out[i * 2 + 1], -0.5f, 1e-4f) << "sample " << i;
+    }
+}
+
+TEST(BandLimitedSynthTest, MatchesFilteringOneSampleAtATime)
+{
+    std::unique_ptr<BandLimitedSynth> vectorSynth(new BandLimitedSynth());
+    std::unique_ptr<BandLimitedSynth> scalarSynth(new BandLimitedSynth());
+    vectorSynth->SetRates(CPU_FREQUENCY, 44100);
+    scalarSynth->SetRates(CPU_FREQUENCY, 44100);
+
+    HighPassFilter filters[4];
+    for (HighPassFilter& filter : filters)
+    {
+        filter.SetParams(1000.0f, 44100.0f);
+    }
+
+    uint32_t seed = 12345;
+    std::vector<float> vectorOut;
+    std::vector<float> scalarOut;
+    for (int block = 0; block < 64; ++block)
+    {
+        // Odd block lengths & deltas all over the block, so the samples read don't always come in pairs
+        seed = seed * 1664525u + 1013904223u;
+        const uint32_t cycles = (seed >> 16) % 20000 + 1;
+        for (int i = 0; i < 32; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            uint32_t time = (seed >> 8) % cycles;
+            float deltaLeft = static_cast<float>(static_cast<int32_t>(seed & 0xFF) - 128) / 256.0f;
+            float deltaRight = static_cast<float>(static_cast<int32_t>((seed >> 24) & 0xFF) - 128) / 256.0f;
+            vectorSynth->AddDelta(time, deltaLeft, deltaRight);
+            scalarSynth->AddDelta(time, deltaLeft, deltaRight);
+        }
+        vectorSynth->EndBlock(cycles);
+        scalarSynth->EndBlock(cycles);
+
+        const uint32_t count = vectorSynth->GetAvailableSamples();
+        ASSERT_EQ(scalarSynth->GetAvailableSamples(), count);
+        vectorOut.assign(count * 2, 0.0f);
+        scalarOut.assign(count * 2, 0.0f);
+        vectorSynth->ReadSamples(vectorOut.data(), count, filters[0], filters[1]);
+        scalarSynth->ReadSamplesScalar(scalarOut.data(), count, filters[2], filters[3]);
+
+        for (uint32_t i = 0; i < count * 2; ++i)
+        {
+            ASSERT_NEAR(vectorOut[i], scalarOut[i], 1e-4f) << "block " << block << " value " << i;
+        }
+    }
+
+    EXPECT_NEAR(filters[0].m_prevOutput, filters[2].m_prevOutput, 1e-4f);
+    EXPECT_NEAR(filters[1].m_prevOutput, filters[3].m_prevOutput, 1e-4f);
+    EXPECT_NEAR(filters[0].m_prevInput, filters[2].m_prevInput, 1e-4f);
+    EXPECT_NEAR(filters[1].m_prevInput, filters[3].m_prevInput, 1e-4f);
+}
+
+TEST(TimerTest, AdvanceMatchesSteppingEveryTCycle)
+{
+    Allocator* allocator = Allocator::Create(InstanceAllocFunc, InstanceFreeFunc);
+    const uint16_t timerBits[4] = { 512, 8, 32, 128 };
+
+    uint32_t seed = 12345;
+    for (int round = 0; round < 64; ++round)
+    {
+        Scheduler scheduler;
+        Memory memory(allocator, nullptr, &scheduler);
+        Timer timer(nullptr, &scheduler);
+        timer.Init(memory);
+
+        seed = seed * 1664525u + 1013904223u;
+        uint8_t tac = static_cast<uint8_t>(0x04 | (seed >> 30));
+        uint8_t tma = static_cast<uint8_t>(seed >> 8);
+        uint8_t tima = static_cast<uint8_t>(seed >> 16);
+        memory.Write(0xFF07, tac);
+        memory.Write(0xFF06, tma);
+        memory.Write(0xFF05, tima);
+
+        // The old loop, one t-cycle at a time
+        uint16_t div = timer.GetDivider();
+        bool previousEdge = false;
+        uint32_t reloadState = 0;
+
+        for (int chunk = 0; chunk < 64; ++chunk)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            uint32_t mCycles = (seed >> 20) % 700 + 1;
+
+            bool interrupted = false;
+            for (uint32_t i = 0; i < mCycles; ++i)
+            {
+                if (reloadState == 1)
+                {
+                    tima = tma;
+                    interrupted = true;
+                    reloadState = 2;
+                }
+                else if (reloadState == 2)
+                {
+                    reloadState = 0;
+                }
+
+                for (uint32_t t = 0; t < 4; ++t)
+                {
+                    div++;
+                    bool edge = (div & timerBits[tac & 0x3]) != 0;
+                    if (previousEdge && !edge)
+                    {
+                        tima++;
+                        reloadState = tima == 0 ? 1 : reloadState;
+                    }
+                    previousEdge = edge;
+                }
+            }
+
+            timer.Advance(mCycles, memory);
+            ASSERT_EQ(memory.ReadIO(0xFF05), tima) << "round " << round << " chunk " << chunk;
+            ASSERT_EQ(memory.ReadIO(0xFF04), div >> 8) << "round " << round << " chunk " << chunk;
+            ASSERT_EQ((memory.ReadIO(0xFF0F) & 0x04) != 0, interrupted) << "round " << round << " chunk " << chunk;
+            memory.WriteDirect(0xFF0F, 0x00);
+        }
+    }
+
+    Allocator::Destroy(allocator);
+}
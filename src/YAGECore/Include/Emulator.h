@@ -2,6 +2,8 @@
 
 #include "Emulator_C.h"
 
+class Allocator;
+
 typedef void* (*YAGEAllocFunc)(uint32_t);
 typedef void (*YAGEFreeFunc)(void*);
 
@@ -47,12 +49,38 @@ namespace EmulatorInputs
 	};
 }
 
+namespace EmulatorSettings
+{
+	enum class PPUAccuracy
+	{
+		// Every pixel goes through the pixel FIFO, mid-scanline changes show up exactly where they happen
+		PixelFIFO = 0,
+		// Whole scanlines are drawn at once, lines the CPU touches while they are drawn fall back to the pixel FIFO
+		Scanline = 1
+	};
+
+	enum class PixelFormat
+	{
+		// 4 bytes per pixel, R G B A in memory order
+		RGBA8888 = 0,
+		// One native endian uint32_t per pixel, 0xFFRRGGBB
+		XRGB8888 = 1,
+		// One native endian uint16_t per pixel
+		RGB565 = 2,
+		// One byte per pixel holding the shade, 0 is the lightest and 3 the darkest
+		Indexed8 = 3,
+		// Four shades per byte, the leftmost pixel in the two most significant bits
+		Packed2bpp = 4
+	};
+}
+
 namespace EmulatorConstants
 {
 	const uint32_t SCREEN_WIDTH = EMULATOR_SCREEN_WIDTH;
 	const uint32_t SCREEN_HEIGHT = EMULATOR_SCREEN_HEIGHT;
 	const uint32_t SCREEN_SIZE = EMULATOR_SCREEN_SIZE;
 	const double PREFERRED_REFRESH_RATE = EMULATOR_PREFERRED_REFRESH_RATE;
+	const uint32_t TCYCLES_PER_FRAME = EMULATOR_TCYCLES_PER_FRAME;
 }
 
 class Emulator
@@ -61,6 +89,7 @@ public:
 
 	typedef void (*LoggerCallback)(const char* message, uint8_t severity);
 	typedef void (*PersistentMemoryCallback)(const void* data, uint32_t size);
+	typedef void (*FrameReadyCallback)(const void* frameBuffer, void* userData);
 #if _DEBUG
 	typedef void (*DebugCallback)(void* userData);
 #endif
@@ -77,13 +106,34 @@ public:
 	virtual void SetAudioBuffer(float* buffer, uint32_t size, uint32_t sampleRate, uint32_t* startOffset) = 0;
 
 	virtual void Step(EmulatorInputs::InputState, double deltaMs, bool microStepping) = 0;
+	// Runs at least the given amount of t-cycles, rounded up to whole m-cycles, and returns the amount actually run
+	virtual uint64_t RunCycles(EmulatorInputs::InputState, uint64_t tCycles) = 0;
+	// Runs until the PPU enters VBlank, or for one frame's worth of cycles if the LCD is off, and returns the t-cycles run
+	virtual uint64_t RunUntilVBlank(EmulatorInputs::InputState) = 0;
+	// The last completed frame in RGBA8888, or the external frame buffer if one is set
 	virtual const void* GetFrameBuffer() = 0;
+	// Finished scanlines get written straight into the given buffer instead of the internal frames, nullptr switches back to those.
+	// The buffer is written while the frame is drawn, stride is the distance between two lines in bytes
+	virtual void SetFrameBuffer(void* buffer, uint32_t stride, EmulatorSettings::PixelFormat format) = 0;
+	// Called on entering VBlank with the buffer holding the finished frame
+	virtual void SetFrameReadyCallback(FrameReadyCallback callback, void* userData) = 0;
 	virtual uint32_t GetNumberOfGeneratedSamples() = 0;
+	// T-cycles since loading the ROM that were fast-forwarded because the CPU was spinning in a polling loop
+	virtual uint64_t GetSkippedPollingCycles() = 0;
 
 	virtual SerializationView Serialize(bool rawData) = 0;
 	virtual void Deserialize(const SerializationView& data) = 0;
 
 	virtual void SetTurboSpeed(float speed) = 0;
+	// Generates ratio times the sample rate per emulated second, 1 by default. Lets the frontend speed up or slow down its audio
+	// queue by a fraction to make up for the emulation and the audio device running on different clocks
+	virtual void SetAudioRateAdjustment(float ratio) = 0;
+	// Enabled by default. Disabled, no samples get generated even with an audio buffer set, the sound registers behave the same either way
+	virtual void SetAudioEnabled(bool enabled) = 0;
+	// Defaults to PixelFIFO, the mode 3 timing is the same for both
+	virtual void SetPPUAccuracy(EmulatorSettings::PPUAccuracy accuracy) = 0;
+	// Only every nth frame gets drawn, 0 stops drawing altogether. The PPU timing, and with it the emulation, stays the same
+	virtual void SetRenderInterval(uint32_t interval) = 0;
 
 	uint32_t GetMemoryUse() const;
 
@@ -152,4 +202,9 @@ public:
 
 #endif
 	virtual ~Emulator();
+
+protected:
+	explicit Emulator(Allocator* allocator);
+
+	Allocator* m_allocator;
 };
\ No newline at end of file
@@ -47,12 +47,14 @@ struct SerializationView
 #define EMULATOR_SCREEN_SIZE EMULATOR_SCREEN_WIDTH * EMULATOR_SCREEN_HEIGHT
 #define EMULATOR_PREFERRED_REFRESH_RATE 59.73
 #define EMULATOR_CLOCK_MS 0.0002384185791015625
+#define EMULATOR_TCYCLES_PER_FRAME 70224
 #define EMULATOR_GB_MEMORY_SIZE 0x10000
 
 #ifdef _CINTERFACE
 
 	typedef void (*EmulatorLoggerCallback)(const char* message, uint8_t severity);
 	typedef void (*EmulatorPersistentMemoryCallback)(const void* data, uint32_t size);
+	typedef void (*EmulatorFrameReadyCallback)(const void* frameBuffer, void* userData);
 #if _DEBUG
 	typedef void (*EmulatorDebugCallback)(void* userData);
 #endif
@@ -76,6 +78,21 @@ struct SerializationView
 		Start = 8
 	};
 
+	enum EmulatorSettings_PPUAccuracy
+	{
+		PPUAccuracy_PixelFIFO = 0,
+		PPUAccuracy_Scanline = 1
+	};
+
+	enum EmulatorSettings_PixelFormat
+	{
+		PixelFormat_RGBA8888 = 0,
+		PixelFormat_XRGB8888 = 1,
+		PixelFormat_RGB565 = 2,
+		PixelFormat_Indexed8 = 3,
+		PixelFormat_Packed2bpp = 4
+	};
+
 	struct EmulatorInputState
 	{
 		uint8_t m_dPad;
@@ -84,6 +101,8 @@ struct SerializationView
 
 	typedef enum EmulatorInputs_DPad EmulatorInputs_DPad;
 	typedef enum EmulatorInputs_Buttons EmulatorInputs_Buttons;
+	typedef enum EmulatorSettings_PPUAccuracy EmulatorSettings_PPUAccuracy;
+	typedef enum EmulatorSettings_PixelFormat EmulatorSettings_PixelFormat;
 	typedef struct EmulatorInputState EmulatorInputState;
 
 	EmulatorInputState GetDefaultInputState();
@@ -107,13 +126,22 @@ struct SerializationView
 	void SetAudioBuffer(EmulatorCHandle emulator, float* buffer, uint32_t size, uint32_t sampleRate, uint32_t* startOffset);
 
 	void Step(EmulatorCHandle emulator, EmulatorInputState inputState, double deltaMs);
+	uint64_t RunCycles(EmulatorCHandle emulator, EmulatorInputState inputState, uint64_t tCycles);
+	uint64_t RunUntilVBlank(EmulatorCHandle emulator, EmulatorInputState inputState);
 	const void* GetFrameBuffer(EmulatorCHandle emulator);
+	void SetFrameBuffer(EmulatorCHandle emulator, void* buffer, uint32_t stride, EmulatorSettings_PixelFormat format);
+	void SetFrameReadyCallback(EmulatorCHandle emulator, EmulatorFrameReadyCallback callback, void* userData);
 	uint32_t GetNumberOfGeneratedSamples(EmulatorCHandle emulator);
+	uint64_t GetSkippedPollingCycles(EmulatorCHandle emulator);
 
 	struct SerializationView Serialize(EmulatorCHandle emulator, uint8_t rawData);
 	void Deserialize(EmulatorCHandle emulator, const struct SerializationView* data);
 
 	void SetTurboSpeed(EmulatorCHandle emulator, float speed);
+	void SetAudioRateAdjustment(EmulatorCHandle emulator, float ratio);
+	void SetAudioEnabled(EmulatorCHandle emulator, uint8_t enabled);
+	void SetPPUAccuracy(EmulatorCHandle emulator, EmulatorSettings_PPUAccuracy accuracy);
+	void SetRenderInterval(EmulatorCHandle emulator, uint32_t interval);
 
 #if _DEBUG
 	void SetInstructionCallback(EmulatorCHandle emulator, uint8_t instr, EmulatorDebugCallback callback, void* userData);
@@ -49,6 +49,10 @@
 
 #define APU_ON_OFF_BIT 0x80
 
+// DIV bit 4 is bit 12 of the internal divider, the frame sequencer steps every time it falls
+#define FRAME_SEQUENCER_DIVIDER_BIT 0x1000
+#define FRAME_SEQUENCER_DIVIDER_PERIOD 0x2000
+
 #define FRAME_SEQUENCER_NO_PULSE 0
 
 using namespace AudioProcessors;
@@ -147,20 +151,6 @@ namespace
 		memory.WriteIO(CHANNEL4_CONTROL_REGISTER, 0xBF);
 	}
 
-	void UpdateMasterVolume(Memory& memory, Sample& sample)
-	{
-		uint8_t rawMasterVolume = memory.ReadIO(MASTER_VOLUME_REGISTER);
-		uint8_t volRight = rawMasterVolume & MASTER_VOLUME_RIGHT_BITS;
-		uint8_t volLeft = (rawMasterVolume & MASTER_VOLUME_LEFT_BITS) >> MASTER_VOLUME_LEFT_SHIFT;
-		volRight += 1;
-		volLeft += 1;
-		float finalVolRight = static_cast<float>(volRight) / MASTER_VOLUME_MAX;
-		float finalVolLeft = static_cast<float>(volLeft) / MASTER_VOLUME_MAX;
-
-		sample.m_left *= finalVolLeft;
-		sample.m_right *= finalVolRight;
-	}
-
 	//Obscure length counter behaviour: if length enable bit is set in the first half of the frame sequencer step,
 	// the length counter is decremented
 	void CheckForLengthEnableBug(uint32_t frameSequencerStep, const uint8_t& newValue, const uint8_t& prevValue, bool resetLength, ChannelData& channel, bool triggered, Memory* memory)
@@ -197,7 +187,7 @@ namespace
 	}
 }
 
-APU::APU(GamestateSerializer* serializer) : ISerializable(serializer, ChunkId::APU)
+APU::APU(GamestateSerializer* serializer, Scheduler* scheduler, Timer* timer) : ISerializable(serializer, ChunkId::APU)
 	, m_channels{
 		ChannelData(0, 64, 4, 7, 0x3F, CHANNEL1_MASTER_CONTROL_ON_OFF_BIT, CHANNEL1_CONTROL_FREQ_HIGH_REGISTER, CHANNEL1_LENGTH_DUTY_REGISTER, CHANNEL1_ENVELOPE_REGISTER,CHANNEL1_FREQUENCY_LOW_REGISTER, CHANNEL1_SWEEP_REGISTER),
 		ChannelData(1, 64, 4, 7, 0x3F, CHANNEL2_MASTER_CONTROL_ON_OFF_BIT, CHANNEL2_CONTROL_FREQ_HIGH_REGISTER, CHANNEL2_LENGTH_DUTY_REGISTER, CHANNEL2_ENVELOPE_REGISTER, CHANNEL2_FREQUENCY_LOW_REGISTER, 0x0),
@@ -207,13 +197,20 @@ APU::APU(GamestateSerializer* serializer) : ISerializable(serializer, ChunkId::A
 	, m_frameSequencerStep(0)
 	, m_wasDivBit4Set(false)
 	, m_cachedFrameSequencerPulse(FRAME_SEQUENCER_NO_PULSE)
+	, m_scheduler(scheduler)
+	, m_timer(timer)
+	, m_memory(nullptr)
+	, m_syncedCycle(0)
+	, m_divider(0)
+	, m_turboSpeed(1.0f)
+	, m_rateAdjustment(1.0f)
+	, m_isEnabled(true)
+	, m_generatedSamples(0)
 {
 	m_externalAudioBuffer.buffer = nullptr;
 	m_externalAudioBuffer.size = 0;
 	m_externalAudioBuffer.sampleRate = 0;
 	m_externalAudioBuffer.currentPosition = 0;
-	m_externalAudioBuffer.resampleRate = 0.0f;
-	m_externalAudioBuffer.samplesToGenerate = 0.0f;
 
 	m_totalSequencerSteps = 0;
 }
@@ -246,14 +243,23 @@ void APU::Init(Memory& memory)
 
 	memory.RegisterCallback(CHANNEL3_ON_OFF_REGISTER, SetChannel3DACActive, this);
 
-	m_accumulatedCycles = 0;
+	memory.RegisterCallback(DIVIDER_REGISTER, ResetDivider, this);
+
 	m_frameSequencerStep = 0;
 	m_cachedFrameSequencerPulse = FRAME_SEQUENCER_NO_PULSE;
 	m_wasDivBit4Set = false;
+	m_generatedSamples = 0;
+
+	m_memory = &memory;
+	ResetSync();
+	memory.SetAudioSyncCallback(RegisterWrite, this);
 }
 
 void APU::SetExternalAudioBuffer(float* buffer, uint32_t size, uint32_t sampleRate, uint32_t* startOffset)
 {
+	// The cycles so far still go to the previous buffer at the previous rate
+	Sync();
+
 	m_externalAudioBuffer.buffer = buffer;
 	m_externalAudioBuffer.size = size;
 	m_externalAudioBuffer.sampleRate = sampleRate;
@@ -262,20 +268,149 @@ void APU::SetExternalAudioBuffer(float* buffer, uint32_t size, uint32_t sampleRa
 	m_HPFLeft.SetParams(1000.0f, static_cast<float>(sampleRate));
 	m_HPFRight.SetParams(1000.0f, static_cast<float>(sampleRate));
 
-	m_externalAudioBuffer.resampleRate = static_cast<double>(m_externalAudioBuffer.sampleRate) / CPU_FREQUENCY;
+	UpdateSynthRates();
+
+	// Whatever the channels were still ringing out belongs to the previous buffer
+	ClearOutput();
+}
+
+void APU::SetTurboSpeed(float turboSpeed)
+{
+	Sync();
+	m_turboSpeed = turboSpeed;
+	UpdateSynthRates();
+}
+
+void APU::SetRateAdjustment(float ratio)
+{
+	if (ratio == m_rateAdjustment)
+	{
+		return;
+	}
+
+	Sync();
+	m_rateAdjustment = ratio;
+	UpdateSynthRates();
+}
+
+void APU::SetEnabled(bool enabled)
+{
+	if (enabled == m_isEnabled)
+	{
+		return;
+	}
+
+	Sync();
+	m_isEnabled = enabled;
+	UpdateSynthRates();
+
+	// The levels from before turning it off don't match the channels anymore
+	ClearOutput();
+}
+
+// A sample rate of 0 leaves the synth inactive, which keeps the channels from rendering. The frame sequencer steps still run
+void APU::UpdateSynthRates()
+{
+	double clockRate = static_cast<double>(CPU_FREQUENCY) * static_cast<double>(m_turboSpeed) / static_cast<double>(m_rateAdjustment);
+	m_synth.SetRates(clockRate, m_isEnabled ? m_externalAudioBuffer.sampleRate : 0);
+}
+
+void APU::ClearOutput()
+{
+	m_synth.Clear();
+	for (uint32_t i = 0; i < CHANNEL_COUNT; ++i)
+	{
+		m_channelOutputs[i] = ChannelOutput();
+	}
+}
+
+void APU::Update()
+{
+	CatchUp(m_scheduler->GetCurrentCycle());
+	ScheduleNextUpdate();
+}
+
+void APU::Sync()
+{
+	CatchUp(m_scheduler->GetCurrentCycle());
+}
+
+void APU::ResetSync()
+{
+	m_syncedCycle = m_scheduler->GetCurrentCycle();
+	m_divider = m_timer->GetDivider();
+	ScheduleNextUpdate();
+}
+
+uint32_t APU::TakeGeneratedSamples()
+{
+	uint32_t generatedSamples = m_generatedSamples;
+	m_generatedSamples = 0;
+	return generatedSamples;
+}
+
+// Between frame sequencer steps the channels only depend on their registers, which can't change without a sync first.
+// So the m-cycles up to the next step are rendered in one block.
+void APU::CatchUp(uint64_t cycle)
+{
+	while (m_syncedCycle < cycle)
+	{
+		uint64_t sequencerCycle = GetNextFrameSequencerCycle();
+		uint64_t endCycle = sequencerCycle < cycle ? sequencerCycle : cycle;
+
+		// Without anyone listening the channels don't need to run, none of their state between the frame sequencer steps is visible
+		if (m_synth.IsActive())
+		{
+			uint64_t maxCycles = m_synth.GetMaxBlockCycles() / MCYCLES_TO_CYCLES;
+			if (m_syncedCycle + maxCycles < endCycle)
+			{
+				endCycle = m_syncedCycle + (maxCycles > 0 ? maxCycles : 1);
+			}
+			Render(*m_memory, static_cast<uint32_t>(endCycle - m_syncedCycle) * MCYCLES_TO_CYCLES);
+		}
+
+		bool isSequencerStep = endCycle == sequencerCycle;
+		AdvanceTo(endCycle);
+
+		if (isSequencerStep)
+		{
+			StepFrameSequencer(*m_memory);
+		}
+	}
 }
 
-uint32_t APU::Update(Memory& memory, uint32_t cyclesPassed, float turboSpeed)
+void APU::AdvanceTo(uint64_t cycle)
 {
-	uint32_t cyclesToStep = cyclesPassed;
+	uint32_t tCycles = static_cast<uint32_t>(cycle - m_syncedCycle) * MCYCLES_TO_CYCLES;
+	m_divider += static_cast<uint16_t>(tCycles);
+	m_wasDivBit4Set = (m_divider & FRAME_SEQUENCER_DIVIDER_BIT) != 0;
+	m_syncedCycle = cycle;
+}
 
-	m_externalAudioBuffer.samplesToGenerate += (static_cast<double>(cyclesToStep) * m_externalAudioBuffer.resampleRate) * (1.0 / static_cast<double>(turboSpeed));
-	
-	m_accumulatedCycles += cyclesToStep;
-	
-	uint32_t samplesgenerated = static_cast<uint32_t>(m_externalAudioBuffer.samplesToGenerate);
+uint64_t APU::GetNextFrameSequencerCycle() const
+{
+	// The bit seen last can differ from the divider if DIV was just written
+	uint16_t divider = static_cast<uint16_t>(m_divider + MCYCLES_TO_CYCLES);
+	if (m_wasDivBit4Set && (divider & FRAME_SEQUENCER_DIVIDER_BIT) == 0)
+	{
+		return m_syncedCycle + 1;
+	}
 
-	UpdateFrameSequencer(memory);
+	// From then on the bit only falls when the divider wraps around to a multiple of the period
+	uint32_t cyclesToWrap = FRAME_SEQUENCER_DIVIDER_PERIOD - (divider & (FRAME_SEQUENCER_DIVIDER_PERIOD - 1));
+	return m_syncedCycle + 1 + (cyclesToWrap + MCYCLES_TO_CYCLES - 1) / MCYCLES_TO_CYCLES;
+}
+
+void APU::ScheduleNextUpdate()
+{
+	m_scheduler->Schedule(SchedulerEvent::APU, GetNextFrameSequencerCycle());
+}
+
+void APU::StepFrameSequencer(Memory& memory)
+{
+	m_totalSequencerSteps++;
+	m_frameSequencerStep = (m_frameSequencerStep + 1) % 8;
+	m_cachedFrameSequencerPulse = m_frameSequencerStep;
 
 	const uint8_t LENGTH_TICK_RATE = 1;
 	const uint8_t SWEEP_TICK_RATE = 3;
@@ -304,81 +439,97 @@ uint32_t APU::Update(Memory& memory, uint32_t cyclesPassed, float turboSpeed)
 	}
 
 	m_cachedFrameSequencerPulse = FRAME_SEQUENCER_NO_PULSE;
+}
 
-	if (m_externalAudioBuffer.samplesToGenerate < 1.0f )
-	{
-		return samplesgenerated;
-	}
+// Renders the given t-cycles after the synced cycle and hands the finished samples over to the audio buffer
+void APU::Render(Memory& memory, uint32_t cycles)
+{
+	UpdateMix(memory);
 
-	Sample sample;
-	if ((memory.ReadIO(AUDIO_MASTER_CONTROL_REGISTER) & APU_ON_OFF_BIT) == 0)
-	{
-		m_accumulatedCycles = 0;
-		GenerateSamples(m_externalAudioBuffer, sample, m_HPFLeft, m_HPFRight);
-		return samplesgenerated;
-	}
+	Channel1::Render(memory, m_channels[0], 0, cycles, m_channelOutputs[0], m_synth);
+	Channel2::Render(memory, m_channels[1], 0, cycles, m_channelOutputs[1], m_synth);
+	Channel3::Render(memory, m_channels[2], 0, cycles, m_channelOutputs[2], m_synth);
+	Channel4::Render(memory, m_channels[3], 0, cycles, m_channelOutputs[3], m_synth);
 
-	Channel1::Render(memory, m_channels[0], m_accumulatedCycles, sample);
-	Channel2::Render(memory, m_channels[1], m_accumulatedCycles, sample);
-	Channel3::Render(memory, m_channels[2], m_accumulatedCycles, sample);
-	Channel4::Render(memory, m_channels[3], m_accumulatedCycles, sample);
+	m_synth.EndBlock(cycles);
+	WriteToAudioBuffer();
+}
 
-	m_accumulatedCycles = 0;
+// Whatever changed the mix since the last block was a register write or a frame sequencer step, both happened right at its start.
+// Channels that are off still play their DAC level if it's on, all of them are silent with the APU off
+void APU::UpdateMix(Memory& memory)
+{
+	bool isAPUOn = (memory.ReadIO(AUDIO_MASTER_CONTROL_REGISTER) & APU_ON_OFF_BIT) != 0;
 
-	//TODO is this necessary when we have a HPF?
-	if (sample.m_activeChannels != 0)
+	uint32_t mixedChannels = 0;
+	for (uint32_t i = 0; i < CHANNEL_COUNT; ++i)
 	{
-		sample.m_left /= sample.m_activeChannels;
-		sample.m_right /= sample.m_activeChannels;
+		if (m_channels[i].m_enabled || m_channels[i].m_DACEnabled)
+		{
+			mixedChannels++;
+		}
 	}
-	
-	UpdateMasterVolume(memory, sample);
 
-	GenerateSamples(m_externalAudioBuffer, sample, m_HPFLeft, m_HPFRight);
+	uint8_t rawMasterVolume = memory.ReadIO(MASTER_VOLUME_REGISTER);
+	uint8_t volRight = (rawMasterVolume & MASTER_VOLUME_RIGHT_BITS) + 1;
+	uint8_t volLeft = ((rawMasterVolume & MASTER_VOLUME_LEFT_BITS) >> MASTER_VOLUME_LEFT_SHIFT) + 1;
+	float finalVolRight = static_cast<float>(volRight) / MASTER_VOLUME_MAX;
+	float finalVolLeft = static_cast<float>(volLeft) / MASTER_VOLUME_MAX;
+	uint8_t panning = memory.ReadIO(SOUND_PANNING_REGISTER);
 
-	return samplesgenerated;
-}
+	float amplitudes[CHANNEL_COUNT] =
+	{
+		Channel1::GetAmplitude(memory, m_channels[0]),
+		Channel2::GetAmplitude(memory, m_channels[1]),
+		Channel3::GetAmplitude(memory, m_channels[2]),
+		Channel4::GetAmplitude(memory, m_channels[3]),
+	};
 
-void APU::UpdateFrameSequencer(Memory& memory)
-{
-	bool divBit4 = (memory.ReadIO(DIVIDER_REGISTER) & 0x10) != 0;
-	if (!divBit4 && m_wasDivBit4Set)
+	for (uint32_t i = 0; i < CHANNEL_COUNT; ++i)
 	{
-		m_totalSequencerSteps++;
-		m_frameSequencerStep = (m_frameSequencerStep + 1) % 8;
-		m_cachedFrameSequencerPulse = m_frameSequencerStep;
+		ChannelOutput& output = m_channelOutputs[i];
+		bool isMixed = isAPUOn && (m_channels[i].m_enabled || m_channels[i].m_DACEnabled);
+		bool hasLeft = ((panning >> (i + 4)) & 0x01) != 0;
+		bool hasRight = ((panning >> i) & 0x01) != 0;
+
+		output.m_gainLeft = isMixed && hasLeft ? finalVolLeft / mixedChannels : 0.0f;
+		output.m_gainRight = isMixed && hasRight ? finalVolRight / mixedChannels : 0.0f;
+		AudioChannel_Internal::SetOutput(output, amplitudes[i], 0, m_synth);
 	}
-	m_wasDivBit4Set = divBit4;
 }
 
-void APU::GenerateSamples(ExternalAudioBuffer& externalAudioBuffer, const Sample& sample, HighPassFilter& hpfLeft, HighPassFilter& hpfRight)
+void APU::WriteToAudioBuffer()
 {
-	while (externalAudioBuffer.samplesToGenerate >= 1.0f)
+	uint32_t samples = m_synth.GetAvailableSamples();
+	m_generatedSamples += samples;
+
+	ExternalAudioBuffer& buffer = m_externalAudioBuffer;
+	if (!buffer.buffer || !buffer.currentPosition || buffer.size < 2)
 	{
-		float processedLeft = hpfLeft.ProcessSample(sample.m_left);
-		float processedRight = hpfRight.ProcessSample(sample.m_right);
-		WriteToAudioBuffer(&externalAudioBuffer, processedLeft, processedRight);
+		m_synth.ReadSamples(nullptr, samples, m_HPFLeft, m_HPFRight);
+		return;
+	}
 
-		if (*externalAudioBuffer.currentPosition >= externalAudioBuffer.size)
+	while (samples > 0)
+	{
+		uint32_t& position = *buffer.currentPosition;
+		if (position + 2 > buffer.size)
 		{
-			*externalAudioBuffer.currentPosition = 0;
+			position = 0;
 		}
 
-		externalAudioBuffer.samplesToGenerate--;
-	}
-}
+		uint32_t count = (buffer.size - position) / 2;
+		count = count < samples ? count : samples;
 
-void APU::WriteToAudioBuffer(ExternalAudioBuffer* buffer, float leftSample, float rightSample)
-{
-	if (!buffer->buffer)
-	{
-		return;
-	}
+		m_synth.ReadSamples(buffer.buffer + position, count, m_HPFLeft, m_HPFRight);
+		position += count * 2;
+		samples -= count;
 
-	float* left = buffer->buffer + (*buffer->currentPosition)++;
-	float* right = buffer->buffer + (*buffer->currentPosition)++;
-	*left = leftSample;
-	*right = rightSample;
+		if (position >= buffer.size)
+		{
+			position = 0;
+		}
+	}
 }
 
 void APU::CheckForReset(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
@@ -511,6 +662,20 @@ void APU::IsChannelTriggered(Memory* memory, uint16_t addr, uint8_t prevValue, u
 	}
 }
 
+// A DIV write restarts the divider, the frame sequencer still compares against the bit it saw before
+void APU::ResetDivider(Memory*, uint16_t, uint8_t, uint8_t, void* userData)
+{
+	APU* apu = static_cast<APU*>(userData);
+	apu->Sync();
+	apu->m_divider = 0;
+	apu->ScheduleNextUpdate();
+}
+
+void APU::RegisterWrite(void* userData)
+{
+	static_cast<APU*>(userData)->Sync();
+}
+
 void APU::Serialize(uint8_t* data)
 {
 	for (uint32_t i = 0; i < CHANNEL_COUNT; ++i)
@@ -523,7 +688,6 @@ void APU::Serialize(uint8_t* data)
 	WriteAndMove(data, &m_frameSequencerStep, sizeof(uint32_t));
 	WriteAndMove(data, &m_wasDivBit4Set, sizeof(bool));
 	WriteAndMove(data, &m_cachedFrameSequencerPulse, sizeof(uint8_t));
-	WriteAndMove(data, &m_accumulatedCycles, sizeof(uint32_t));
 }
 
 void APU::Deserialize(const uint8_t* data)
@@ -538,33 +702,10 @@ void APU::Deserialize(const uint8_t* data)
 	ReadAndMove(data, &m_frameSequencerStep, sizeof(uint32_t));
 	ReadAndMove(data, &m_wasDivBit4Set, sizeof(bool));
 	ReadAndMove(data, &m_cachedFrameSequencerPulse, sizeof(uint8_t));
-	ReadAndMove(data, &m_accumulatedCycles, sizeof(uint32_t));
 }
 
 uint32_t APU::GetSerializationSize()
 {
 	return sizeof(ChannelData) * CHANNEL_COUNT + sizeof(HighPassFilter) * 2 + sizeof(uint32_t)
-		+ sizeof(bool) + sizeof(uint8_t) + sizeof(uint32_t);
-}
-
-APU::HighPassFilter::HighPassFilter() :
-	m_alpha(0.0f)
-	, m_prevOutput(0.0f)
-	, m_prevInput(0.0f)
-{
-}
-
-void APU::HighPassFilter::SetParams(float cutoff, float sampleRate)
-{
-	const float PI = 3.141592654f;
-	m_alpha = 1.0f / (1.0f + 2.0f * PI * cutoff / sampleRate);
-}
-
-float APU::HighPassFilter::ProcessSample(float inputSample)
-{
-	float output = m_alpha * (m_prevOutput + inputSample - m_prevInput);
-
-	m_prevInput = inputSample;
-	m_prevOutput = output;
-	return output;
+		+ sizeof(bool) + sizeof(uint8_t);
 }
@@ -1,5 +1,7 @@
 #pragma once
 #include "Memory.h"
+#include "Scheduler.h"
+#include "Timer.h"
 #include "AudioChannel.h"
 
 #define CHANNEL_COUNT 4
@@ -7,27 +9,22 @@
 class APU : ISerializable
 {
 public:
-	APU(GamestateSerializer* serializer);
+	APU(GamestateSerializer* serializer, Scheduler* scheduler, Timer* timer);
 	void Init(Memory& memory);
 	void SetExternalAudioBuffer(float* buffer, uint32_t size, uint32_t sampleRate, uint32_t* startOffset);
+	void SetTurboSpeed(float turboSpeed);
+	void SetRateAdjustment(float ratio);
+	// Disabled, the channels only keep up their register visible state. Nothing gets mixed or written to the audio buffer
+	void SetEnabled(bool enabled);
 
-	uint32_t Update(Memory& memory, uint32_t cyclesPassed, float turboSpeed);
+	void Update();
+	void Sync();
+	void ResetSync();
 
-private:
-
-	class HighPassFilter
-	{
-	public:
-		HighPassFilter();
-
-		void SetParams(float cutoff, float sampleRate);
-		float ProcessSample(float inputSample);
+	// Samples written to the audio buffer since the last call
+	uint32_t TakeGeneratedSamples();
 
-	private:
-		float m_alpha;
-		float m_prevOutput;
-		float m_prevInput;
-	};
+private:
 
 	struct ExternalAudioBuffer
 	{
@@ -35,12 +32,9 @@ private:
 		uint32_t size;
 		uint32_t sampleRate;
 		uint32_t* currentPosition;
-		double resampleRate;
-		double samplesToGenerate;
 	};
 
-	static void GenerateSamples(ExternalAudioBuffer& externalAudioBuffer, const Sample& sample, HighPassFilter& hpfLeft, HighPassFilter& hpfRight);
-	static void WriteToAudioBuffer(APU::ExternalAudioBuffer* buffer, float leftSample, float rightSample);
+	void WriteToAudioBuffer();
 
 	static void CheckForReset(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
 	static void CheckForSweepReverse(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
@@ -48,19 +42,42 @@ private:
 	static void SetChannelsDACActive(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
 	static void SetChannel3DACActive(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
 	static void IsChannelTriggered(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
+	static void ResetDivider(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
+	static void RegisterWrite(void* userData);
 
 	ChannelData m_channels[CHANNEL_COUNT];
+	ChannelOutput m_channelOutputs[CHANNEL_COUNT];
 	ExternalAudioBuffer m_externalAudioBuffer;
+	BandLimitedSynth m_synth;
 	uint8_t m_cachedFrameSequencerPulse;
 	uint32_t m_frameSequencerStep;
 	bool m_wasDivBit4Set;
 	HighPassFilter m_HPFLeft;
 	HighPassFilter m_HPFRight;
 
-	uint32_t m_accumulatedCycles;
 	uint32_t m_totalSequencerSteps = 0;
 
-	void UpdateFrameSequencer(Memory& memory);
+	Scheduler* m_scheduler;
+	Timer* m_timer;
+	Memory* m_memory;
+	uint64_t m_syncedCycle;
+	// Divider at the synced m-cycle, from there on it counts up every m-cycle until DIV gets written
+	uint16_t m_divider;
+	float m_turboSpeed;
+	// Output samples per emulated second relative to the sample rate
+	float m_rateAdjustment;
+	bool m_isEnabled;
+	uint32_t m_generatedSamples;
+
+	void CatchUp(uint64_t cycle);
+	void AdvanceTo(uint64_t cycle);
+	uint64_t GetNextFrameSequencerCycle() const;
+	void ScheduleNextUpdate();
+	void UpdateSynthRates();
+	void ClearOutput();
+	void StepFrameSequencer(Memory& memory);
+	void Render(Memory& memory, uint32_t cycles);
+	void UpdateMix(Memory& memory);
 
 	// Inherited via ISerializable
 	void Serialize(uint8_t* data) override;
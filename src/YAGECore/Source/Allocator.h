@@ -23,75 +23,64 @@ T Align(T value, uint64_t alignment)
 class Allocator
 {
 public:
-	static void Initialize(YAGEAllocFunc allocFunc, YAGEFreeFunc freeFunc)
+	// The allocator lives at the start of its own memory block, so each emulator instance owns a fully independent arena
+	static Allocator* Create(YAGEAllocFunc allocFunc, YAGEFreeFunc freeFunc)
 	{
-		Allocator& instance = GetInstance();
-		instance.m_allocFunc = allocFunc;
-		instance.m_freeFunc = freeFunc;
-		instance.m_buffer = static_cast<uint8_t*>(Align(allocFunc(INITIAL_MEMORY_REQUEST),16));
-		instance.m_nextFree = instance.m_buffer;
-		instance.m_allocatedSize = 0;
-#ifdef _DEBUG
-		instance.m_allocCount = 0;
-#endif
-	}
-
-	static void FreeAll()
-	{
-		Allocator& instance = GetInstance();
-		if (instance.m_buffer)
+		void* rawBuffer = allocFunc(INITIAL_MEMORY_REQUEST);
+		if (!rawBuffer)
 		{
-#ifdef _DEBUG
-			if(instance.m_allocCount != 0)
-			{
-				LOG_ERROR(string_format("Non-Zero allocation count during allocator cleanup: %d", instance.m_allocCount).c_str());
-			}
-#endif
-			instance.m_freeFunc(instance.m_buffer);
-			instance.m_buffer = nullptr;
+			return nullptr;
 		}
-	}
 
-	static Allocator& GetInstance() 
-	{
-		static Allocator instance;
-		return instance;
+		return new (Align(rawBuffer, 16)) Allocator(rawBuffer, allocFunc, freeFunc);
 	}
 
-	static void* Malloc(uint32_t size)
+	static void Destroy(Allocator* allocator)
 	{
-		Allocator& instance = GetInstance();
+		if (!allocator)
+		{
+			return;
+		}
 
-		if (!instance.m_buffer)
+#ifdef _DEBUG
+		if (allocator->m_allocCount != 0)
 		{
-			LOG_ERROR("Trying to allocate memory from a non-initialized allocator");
-			return nullptr;
+			LOG_ERROR(string_format("Non-Zero allocation count during allocator cleanup: %d", allocator->m_allocCount).c_str());
 		}
+#endif
+		YAGEFreeFunc freeFunc = allocator->m_freeFunc;
+		void* rawBuffer = allocator->m_rawBuffer;
+		allocator->~Allocator();
+		freeFunc(rawBuffer);
+	}
 
+	void* Malloc(uint32_t size)
+	{
 		size = Align(size, 16);
-		instance.m_allocatedSize += size;
 
-		if (instance.m_allocatedSize >= instance.m_bufferCapacity)
+		if (m_allocatedSize + size > m_bufferCapacity)
 		{
 			LOG_ERROR("Max requested memory size reached. Cannot allocate more. Bump up the requested memory count.");
 			return nullptr;
 		}
 
-		void* returnAddr = instance.m_nextFree;
+		m_allocatedSize += size;
+
+		void* returnAddr = m_nextFree;
 
-		instance.m_nextFree += size;
+		m_nextFree += size;
 
 #ifdef _DEBUG
-		instance.m_allocCount++;
+		m_allocCount++;
 #endif
 
 		return returnAddr;
 	}
 
-	static void Free(void* ptr)
+	void Free(void* ptr)
 	{
 #ifdef _DEBUG
-		GetInstance().m_allocCount--;
+		m_allocCount--;
 #endif
 		//As this is a linear allocator, nothing to do here.
 	}
@@ -107,25 +96,20 @@ public:
 	Allocator& operator=(Allocator&&) = delete;
 
 private:
-	Allocator() = default;
-#ifdef FREESTANDING
-	// Need default destructor for freestanding environment as we do not have __cxa_atexit for calling of non-trivial destructors of static local variables
-	// Memory will still get cleaned up by call to FreeAll() when destroying the emulator
-	~Allocator() = default;
-#else
-	~Allocator()
+	Allocator(void* rawBuffer, YAGEAllocFunc allocFunc, YAGEFreeFunc freeFunc)
+		: m_rawBuffer(rawBuffer)
+		, m_allocFunc(allocFunc)
+		, m_freeFunc(freeFunc)
 	{
-		if( m_freeFunc )
-		{
-			m_freeFunc(m_buffer);
-		}
+		uint8_t* blockEnd = static_cast<uint8_t*>(rawBuffer) + INITIAL_MEMORY_REQUEST;
+		m_nextFree = Align(reinterpret_cast<uint8_t*>(this) + sizeof(Allocator), 16);
+		m_bufferCapacity = static_cast<uint32_t>(blockEnd - m_nextFree);
 	}
-#endif
-
+	~Allocator() = default;
 
-	uint8_t* m_buffer = nullptr;
-	const uint32_t m_bufferCapacity = INITIAL_MEMORY_REQUEST;
+	void* m_rawBuffer = nullptr;
 	uint8_t* m_nextFree = nullptr;
+	uint32_t m_bufferCapacity = 0;
 	uint32_t m_allocatedSize = 0;
 
 #ifdef _DEBUG
@@ -138,9 +122,9 @@ private:
 
 // Custom allocation and initialization function
 template <typename T, typename... Args>
-T* YAGENew(Args&&... args)
+T* YAGENew(Allocator* allocator, Args&&... args)
 {
-	void* memory = Allocator::Malloc(sizeof(T));
+	void* memory = allocator->Malloc(sizeof(T));
 	if (!memory)
 	{
 		// TODO Handle allocation failure
@@ -150,12 +134,12 @@ T* YAGENew(Args&&... args)
 }
 
 template <typename T>
-void YAGEDelete(T* ptr)
+void YAGEDelete(Allocator* allocator, T* ptr)
 {
 	if (ptr)
 	{
 		ptr->~T();
-		Allocator::Free(ptr);
+		allocator->Free(ptr);
 	}
 }
 
@@ -166,9 +150,9 @@ struct ArrayHeader
 };
 
 template <typename T>
-T* YAGENewA(size_t count)
+T* YAGENewA(Allocator* allocator, size_t count)
 {
-	void* memory = Allocator::Malloc(sizeof(T) * static_cast<uint32_t>(count) + sizeof(ArrayHeader));
+	void* memory = allocator->Malloc(sizeof(T) * static_cast<uint32_t>(count) + sizeof(ArrayHeader));
 	if (!memory)
 	{
 		// TODO Handle allocation failure
@@ -192,7 +176,7 @@ T* YAGENewA(size_t count)
 
 template <typename T>
 y::enable_if_t<!y::is_trivially_destructible<T>::value>
-YAGEDeleteA(T* ptr)
+YAGEDeleteA(Allocator* allocator, T* ptr)
 {
 	if (ptr)
 	{
@@ -205,24 +189,24 @@ YAGEDeleteA(T* ptr)
 			(ptr + revIndex)->~T();
 		}
 
-		Allocator::Free(countPtr);
+		allocator->Free(countPtr);
 	}
 }
 
 template <typename T>
 y::enable_if_t<y::is_trivially_destructible<T>::value>
-YAGEDeleteA(T* ptr)
+YAGEDeleteA(Allocator* allocator, T* ptr)
 {
 	if (ptr)
 	{
 		ArrayHeader* countPtr = reinterpret_cast<ArrayHeader*>(ptr) - 1;
 
-		Allocator::Free(countPtr);
+		allocator->Free(countPtr);
 	}
 }
 
-#define Y_NEW(type, ...) YAGENew<type>(__VA_ARGS__)
-#define Y_DELETE(ptr) YAGEDelete(ptr)
+#define Y_NEW(allocator, type, ...) YAGENew<type>(allocator, ##__VA_ARGS__)
+#define Y_DELETE(allocator, ptr) YAGEDelete(allocator, ptr)
 
-#define Y_NEW_A(type, count) YAGENewA<type>(count)
-#define Y_DELETE_A(ptr) YAGEDeleteA(ptr)
+#define Y_NEW_A(allocator, type, count) YAGENewA<type>(allocator, count)
+#define Y_DELETE_A(allocator, ptr) YAGEDeleteA(allocator, ptr)
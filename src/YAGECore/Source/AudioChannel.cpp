@@ -87,39 +87,21 @@ void AudioProcessors::PulseFrequency::Trigger(Memory& memory, ChannelData& chann
 	channel.m_dutyStep = 0;
 }
 
-void AudioProcessors::PulseFrequency::UpdateFrequency(Memory& memory, ChannelData& channel, uint32_t cyclesToStep)
+bool AudioProcessors::PulseFrequency::UpdateFrequency(Memory& memory, ChannelData& channel, uint32_t& cyclesToStep)
 {
-	UpdateFrequencyInternal(memory, channel, cyclesToStep);
-}
-
-bool AudioProcessors::PulseFrequency::UpdateFrequencyInternal(Memory& memory, ChannelData& channel, uint32_t cyclesToStep)
-{
-	uint32_t frequency = AudioChannel_Internal::GetFrequency(memory, channel.m_controlRegister, channel.m_frequencyRegister);
-
-	uint32_t remainingSteps = cyclesToStep;
-	bool timerTriggered = false;
-	while (remainingSteps > 0)
+	if (cyclesToStep < channel.m_frequencyTimer)
 	{
-		if (remainingSteps > channel.m_frequencyTimer)
-		{
-			remainingSteps -= channel.m_frequencyTimer;
-			channel.m_frequencyTimer = 0;
-		}
-		else
-		{
-			channel.m_frequencyTimer -= remainingSteps;
-			remainingSteps = 0;
-		}
-
-		if (channel.m_frequencyTimer == 0)
-		{
-			channel.m_frequencyTimer = (2048 - frequency) * channel.m_frequencyFactor;
-			channel.m_dutyStep++;
-			channel.m_dutyStep &= channel.m_maxSampleLength;
-			timerTriggered = true;
-		}
+		channel.m_frequencyTimer -= cyclesToStep;
+		return false;
 	}
-	return timerTriggered;
+
+	cyclesToStep = channel.m_frequencyTimer;
+
+	uint32_t frequency = AudioChannel_Internal::GetFrequency(memory, channel.m_controlRegister, channel.m_frequencyRegister);
+	channel.m_frequencyTimer = (2048 - frequency) * channel.m_frequencyFactor;
+	channel.m_dutyStep++;
+	channel.m_dutyStep &= channel.m_maxSampleLength;
+	return true;
 }
 
 void AudioProcessors::WaveFrequency::Trigger(Memory& memory, ChannelData& channel)
@@ -129,16 +111,19 @@ void AudioProcessors::WaveFrequency::Trigger(Memory& memory, ChannelData& channe
 	channel.m_dutyStep = 1;
 }
 
-void AudioProcessors::WaveFrequency::UpdateFrequency(Memory& memory, ChannelData& channel, const uint32_t& cyclesToStep)
+bool AudioProcessors::WaveFrequency::UpdateFrequency(Memory& memory, ChannelData& channel, uint32_t& cyclesToStep)
 {
 	const uint16_t WAVE_PATTERN_RAM_BEGIN = 0xFF30;
-	if (PulseFrequency::UpdateFrequencyInternal(memory, channel, cyclesToStep))
+	if (!PulseFrequency::UpdateFrequency(memory, channel, cyclesToStep))
 	{
-		uint16_t sampleIndex = channel.m_dutyStep / 2;
-		bool sampleLowerNibble = static_cast<bool>(channel.m_dutyStep % 2);
-		uint8_t doubleSample = memory.ReadIO(WAVE_PATTERN_RAM_BEGIN + sampleIndex);
-		channel.m_sampleBuffer = sampleLowerNibble ? (doubleSample & 0x0F) : (doubleSample >> 4);
+		return false;
 	}
+
+	uint16_t sampleIndex = channel.m_dutyStep / 2;
+	bool sampleLowerNibble = static_cast<bool>(channel.m_dutyStep % 2);
+	uint8_t doubleSample = memory.ReadIO(WAVE_PATTERN_RAM_BEGIN + sampleIndex);
+	channel.m_sampleBuffer = sampleLowerNibble ? (doubleSample & 0x0F) : (doubleSample >> 4);
+	return true;
 }
 
 void AudioProcessors::NoiseFrequency::Trigger(Memory& memory, ChannelData& channel)
@@ -147,53 +132,43 @@ void AudioProcessors::NoiseFrequency::Trigger(Memory& memory, ChannelData& chann
 	channel.m_frequencyTimer = GetNoiseFrequencyTimer(memory.ReadIO(channel.m_frequencyRegister));
 }
 
-void AudioProcessors::NoiseFrequency::UpdateFrequency(Memory& memory, ChannelData& channel, const uint32_t& cyclesToStep)
+bool AudioProcessors::NoiseFrequency::UpdateFrequency(Memory& memory, ChannelData& channel, uint32_t& cyclesToStep)
 {
 	const uint8_t LFSR_WIDTH_BITS = 0x08;
 	const uint8_t LFSR_WIDTH_OFFSET = 3;
 
-	uint32_t remainingSteps = cyclesToStep;
-	while (remainingSteps > 0)
+	if (cyclesToStep < channel.m_frequencyTimer)
 	{
-		if (remainingSteps > channel.m_frequencyTimer)
-		{
-			remainingSteps -= channel.m_frequencyTimer;
-			channel.m_frequencyTimer = 0;
-		}
-		else
-		{
-			channel.m_frequencyTimer -= remainingSteps;
-			remainingSteps = 0;
-		}
+		channel.m_frequencyTimer -= cyclesToStep;
+		return false;
+	}
 
-		if (channel.m_frequencyTimer == 0)
-		{
-			channel.m_frequencyTimer = GetNoiseFrequencyTimer(memory.ReadIO(channel.m_frequencyRegister));
+	cyclesToStep = channel.m_frequencyTimer;
+	channel.m_frequencyTimer = GetNoiseFrequencyTimer(memory.ReadIO(channel.m_frequencyRegister));
 
-			uint16_t shiftRegister = channel.m_lfsr;
-			uint16_t bit1 = shiftRegister & 0x1;
-			uint16_t bit2 = (shiftRegister >> 1) & 0x1;
-			uint16_t nXorResult = ~(bit1 ^ bit2);
+	uint16_t shiftRegister = channel.m_lfsr;
+	uint16_t bit1 = shiftRegister & 0x1;
+	uint16_t bit2 = (shiftRegister >> 1) & 0x1;
+	uint16_t nXorResult = ~(bit1 ^ bit2);
 
-			bool shortWidth = (memory.ReadIO(channel.m_frequencyRegister) & LFSR_WIDTH_BITS) >> LFSR_WIDTH_OFFSET;
+	bool shortWidth = (memory.ReadIO(channel.m_frequencyRegister) & LFSR_WIDTH_BITS) >> LFSR_WIDTH_OFFSET;
 
-			if (shortWidth)
-			{
-				uint16_t shiftMask = shiftRegister & 0x7F7F;
-				shiftRegister = nXorResult << 15 | shiftMask;
-				shiftRegister = nXorResult << 7 | shiftRegister;
-			}
-			else
-			{
-				uint16_t shiftMask = shiftRegister & 0x7FFF;
-				shiftRegister = nXorResult << 15 | shiftMask;
-			}
+	if (shortWidth)
+	{
+		uint16_t shiftMask = shiftRegister & 0x7F7F;
+		shiftRegister = nXorResult << 15 | shiftMask;
+		shiftRegister = nXorResult << 7 | shiftRegister;
+	}
+	else
+	{
+		uint16_t shiftMask = shiftRegister & 0x7FFF;
+		shiftRegister = nXorResult << 15 | shiftMask;
+	}
 
-			shiftRegister >>= 1;
+	shiftRegister >>= 1;
 
-			channel.m_lfsr = shiftRegister;
-		}
-	}
+	channel.m_lfsr = shiftRegister;
+	return true;
 }
 
 uint32_t AudioProcessors::NoiseFrequency::GetNoiseFrequencyTimer(uint8_t frequencyRegister)
@@ -311,14 +286,16 @@ float AudioProcessors::AudioChannel_Internal::DAC(uint8_t amplitude)
 	//return static_cast<float>(amplitude) / 15.0f;
 }
 
-void AudioProcessors::AudioChannel_Internal::Pan(Memory& memory, float amplitude, uint8_t panRegisterOffset, float& mixedAmplitudeLeft, float& mixedAmplitudeRight)
+void AudioProcessors::AudioChannel_Internal::SetOutput(ChannelOutput& output, float amplitude, uint32_t time, BandLimitedSynth& synth)
 {
-	const uint16_t PAN_REGISTER = 0xFF25;
-	bool hasRight = ((memory.ReadIO(PAN_REGISTER) >> panRegisterOffset) & 0x01) > 0;
-	bool hasLeft = ((memory.ReadIO(PAN_REGISTER) >> (panRegisterOffset + 4)) & 0x01) > 0;
-
-	mixedAmplitudeLeft += hasLeft ? amplitude : 0.0f;
-	mixedAmplitudeRight += hasRight ? amplitude : 0.0f;
+	float left = amplitude * output.m_gainLeft;
+	float right = amplitude * output.m_gainRight;
+	if (left != output.m_left || right != output.m_right)
+	{
+		synth.AddDelta(time, left - output.m_left, right - output.m_right);
+		output.m_left = left;
+		output.m_right = right;
+	}
 }
 
 uint32_t AudioProcessors::AudioChannel_Internal::GetFrequency(const Memory& memory, const uint16_t& frequencyHighRegister, const uint16_t& frequencyLowRegister)
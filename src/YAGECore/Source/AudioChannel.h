@@ -1,17 +1,21 @@
 #pragma once
 #include "CppIncludes.h"
 #include "Memory.h"
+#include "BandLimitedSynth.h"
 
-struct Sample
+// A channel's share of the mix. The gains fold in panning, the master volume & the number of channels mixed
+struct ChannelOutput
 {
-	Sample() :
-		  m_left (0.0f)
+	ChannelOutput() :
+		  m_gainLeft(0.0f)
+		, m_gainRight(0.0f)
+		, m_left(0.0f)
 		, m_right(0.0f)
-		, m_activeChannels(0)
 	{}
+	float m_gainLeft;
+	float m_gainRight;
 	float m_left;
 	float m_right;
-	uint32_t m_activeChannels;
 };
 
 struct ChannelData
@@ -100,7 +104,7 @@ namespace AudioProcessors
 	namespace AudioChannel_Internal
 	{
 		float DAC(uint8_t amplitude);
-		void Pan(Memory& memory, float amplitude, uint8_t panRegisterOffset, float& mixedAmplitudeLeft, float& mixedAmplitudeRight);
+		void SetOutput(ChannelOutput& output, float amplitude, uint32_t time, BandLimitedSynth& synth);
 		uint32_t GetFrequency(const Memory& memory, const uint16_t& frequencyHighRegister, const uint16_t& frequencyLowRegister);
 		void SetFrequency(Memory& memory, const uint16_t& frequencyHighRegister, const uint16_t& frequencyLowRegister, uint32_t frequency);
 	}
@@ -133,26 +137,27 @@ namespace AudioProcessors
 		}
 	};
 
+	// UpdateFrequency steps at most the given t-cycles and stops right after the timer ran out.
+	// The t-cycles actually stepped are passed back, the return value tells if the timer ran out
 	class PulseFrequency
 	{
 	public:
 		static void Trigger(Memory& memory, ChannelData& channel);
-		static void UpdateFrequency(Memory& memory, ChannelData& channel, uint32_t cyclesToStep);
-		static bool UpdateFrequencyInternal(Memory& memory, ChannelData& channel, uint32_t cyclesToStep);
+		static bool UpdateFrequency(Memory& memory, ChannelData& channel, uint32_t& cyclesToStep);
 	};
 
 	class WaveFrequency
 	{
 	public:
 		static void Trigger(Memory& memory, ChannelData& channel);
-		static void UpdateFrequency(Memory& memory, ChannelData& channel, const uint32_t& cyclesToStep);
+		static bool UpdateFrequency(Memory& memory, ChannelData& channel, uint32_t& cyclesToStep);
 	};
 
 	class NoiseFrequency
 	{
 	public:
 		static void Trigger(Memory& memory, ChannelData& channel);
-		static void UpdateFrequency(Memory& memory, ChannelData& channel, const uint32_t& cyclesToStep);
+		static bool UpdateFrequency(Memory& memory, ChannelData& channel, uint32_t& cyclesToStep);
 	private:
 		static uint32_t GetNoiseFrequencyTimer(uint8_t frequencyRegister);
 	};
@@ -240,21 +245,33 @@ public:
 		FrequencyProcessor::Trigger(memory, data);
 	}
 
-	static void Render(Memory& memory, ChannelData& data, uint32_t cyclesToStep, Sample& sampleOut)
+	// A channel that is off plays the level of its DAC at 0
+	static float GetAmplitude(const Memory& memory, const ChannelData& data)
 	{
 		using namespace AudioProcessors;
-		if (data.m_enabled)
+		return data.m_enabled ? AmplitudeProcessor::UpdateAmplitude(memory, data) : AudioChannel_Internal::DAC(0);
+	}
+
+	// Runs the channel for the given t-cycles from the given time of the block on, its level changes go into the synth at the t-cycle they happen
+	static void Render(Memory& memory, ChannelData& data, uint32_t time, uint32_t cyclesToStep, ChannelOutput& output, BandLimitedSynth& synth)
+	{
+		using namespace AudioProcessors;
+		if (!data.m_enabled)
 		{
-			FrequencyProcessor::UpdateFrequency(memory, data, cyclesToStep);
-			float amplitude = AmplitudeProcessor::UpdateAmplitude(memory, data);
-			AudioChannel_Internal::Pan(memory, amplitude, data.m_channelId, sampleOut.m_left, sampleOut.m_right);
-			sampleOut.m_activeChannels++;
+			return;
 		}
-		else if (data.m_DACEnabled)
+
+		uint32_t endTime = time + cyclesToStep;
+		while (time < endTime)
 		{
-			float amplitude = AudioChannel_Internal::DAC(0);
-			AudioChannel_Internal::Pan(memory, amplitude, data.m_channelId, sampleOut.m_left, sampleOut.m_right);
-			sampleOut.m_activeChannels++;
+			uint32_t steppedCycles = endTime - time;
+			bool timerRanOut = FrequencyProcessor::UpdateFrequency(memory, data, steppedCycles);
+			time += steppedCycles;
+
+			if (timerRanOut)
+			{
+				AudioChannel_Internal::SetOutput(output, AmplitudeProcessor::UpdateAmplitude(memory, data), time, synth);
+			}
 		}
 	}
 };
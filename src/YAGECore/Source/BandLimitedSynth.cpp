@@ -0,0 +1,258 @@
+#include "BandLimitedSynth.h"
+
+#if BAND_LIMITED_SYNTH_SIMD && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BAND_LIMITED_SYNTH_SSE 1
+#include <emmintrin.h>
+#elif BAND_LIMITED_SYNTH_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+#define BAND_LIMITED_SYNTH_NEON 1
+#include <arm_neon.h>
+#endif
+
+#define FIXED_POINT_SHIFT 32
+#define FIXED_POINT_ONE (1ull << FIXED_POINT_SHIFT)
+#define TAP_VALUES (BAND_LIMITED_SYNTH_TAPS * 2)
+
+namespace
+{
+	const double PI = 3.14159265358979323846;
+
+	// Part of the output Nyquist frequency the steps keep
+	const double KERNEL_CUTOFF = 0.9;
+
+	// Blackman window coefficients
+	const double WINDOW_A0 = 0.42;
+	const double WINDOW_A1 = 0.5;
+	const double WINDOW_A2 = 0.08;
+}
+
+HighPassFilter::HighPassFilter() :
+	m_alpha(0.0f)
+	, m_prevOutput(0.0f)
+	, m_prevInput(0.0f)
+{
+}
+
+void HighPassFilter::SetParams(float cutoff, float sampleRate)
+{
+	const float PI_F = 3.141592654f;
+	m_alpha = 1.0f / (1.0f + 2.0f * PI_F * cutoff / sampleRate);
+}
+
+BandLimitedSynth::BandLimitedSynth()
+	: m_factor(0)
+	, m_offset(0)
+{
+	BuildKernel();
+	Clear();
+}
+
+void BandLimitedSynth::SetRates(double clockRate, uint32_t sampleRate)
+{
+	m_factor = static_cast<uint64_t>(static_cast<double>(sampleRate) / clockRate * static_cast<double>(FIXED_POINT_ONE) + 0.5);
+}
+
+void BandLimitedSynth::Clear()
+{
+	m_offset = 0;
+	memset_y(m_buffer, 0, sizeof(m_buffer));
+}
+
+uint32_t BandLimitedSynth::GetMaxBlockCycles() const
+{
+	if (m_factor == 0)
+	{
+		return 0xFFFFFFFFu;
+	}
+
+	uint64_t freeSamples = BAND_LIMITED_SYNTH_CAPACITY - GetAvailableSamples() - 1;
+	uint64_t cycles = (freeSamples << FIXED_POINT_SHIFT) / m_factor;
+	return cycles < 0xFFFFFFFFull ? static_cast<uint32_t>(cycles) : 0xFFFFFFFFu;
+}
+
+// Windowed sinc impulses, one for each sub-sample phase. Each of them adds up to 1, so a step always settles at its exact height
+void BandLimitedSynth::BuildKernel()
+{
+	const double halfTaps = static_cast<double>(BAND_LIMITED_SYNTH_TAPS / 2);
+
+	for (uint32_t phase = 0; phase < BAND_LIMITED_SYNTH_PHASES; ++phase)
+	{
+		double taps[BAND_LIMITED_SYNTH_TAPS];
+		double sum = 0.0;
+		for (uint32_t i = 0; i < BAND_LIMITED_SYNTH_TAPS; ++i)
+		{
+			double x = static_cast<double>(i) - (halfTaps - 1.0) - static_cast<double>(phase) / BAND_LIMITED_SYNTH_PHASES;
+			double angle = PI * KERNEL_CUTOFF * x;
+			double sinc = x == 0.0 ? 1.0 : sin_y(angle) / angle;
+
+			double windowPosition = (x + halfTaps) / BAND_LIMITED_SYNTH_TAPS;
+			double window = WINDOW_A0 - WINDOW_A1 * cos_y(2.0 * PI * windowPosition) + WINDOW_A2 * cos_y(4.0 * PI * windowPosition);
+
+			taps[i] = sinc * window;
+			sum += taps[i];
+		}
+
+		for (uint32_t i = 0; i < BAND_LIMITED_SYNTH_TAPS; ++i)
+		{
+			float tap = static_cast<float>(taps[i] / sum);
+			m_kernel[phase][i * 2] = tap;
+			m_kernel[phase][i * 2 + 1] = tap;
+		}
+	}
+}
+
+void BandLimitedSynth::AddDelta(uint32_t time, float left, float right)
+{
+	uint64_t position = m_offset + static_cast<uint64_t>(time) * m_factor;
+	uint32_t index = static_cast<uint32_t>(position >> FIXED_POINT_SHIFT);
+	uint32_t phase = static_cast<uint32_t>(position >> (FIXED_POINT_SHIFT - BAND_LIMITED_SYNTH_PHASE_BITS)) & (BAND_LIMITED_SYNTH_PHASES - 1);
+
+	const float* kernel = m_kernel[phase];
+	float* out = m_buffer + index * 2;
+
+#if BAND_LIMITED_SYNTH_SSE
+	const __m128 delta = _mm_setr_ps(left, right, left, right);
+	for (uint32_t i = 0; i < TAP_VALUES; i += 4)
+	{
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(kernel + i), delta)));
+	}
+#elif BAND_LIMITED_SYNTH_NEON
+	const float deltaValues[4] = { left, right, left, right };
+	const float32x4_t delta = vld1q_f32(deltaValues);
+	for (uint32_t i = 0; i < TAP_VALUES; i += 4)
+	{
+		vst1q_f32(out + i, vmlaq_f32(vld1q_f32(out + i), vld1q_f32(kernel + i), delta));
+	}
+#else
+	for (uint32_t i = 0; i < TAP_VALUES; i += 2)
+	{
+		out[i] += kernel[i] * left;
+		out[i + 1] += kernel[i + 1] * right;
+	}
+#endif
+}
+
+void BandLimitedSynth::EndBlock(uint32_t time)
+{
+	m_offset += static_cast<uint64_t>(time) * m_factor;
+}
+
+void BandLimitedSynth::ReadSamplesScalar(float* out, uint32_t count, HighPassFilter& left, HighPassFilter& right)
+{
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		float deltaLeft = m_buffer[i * 2];
+		float deltaRight = m_buffer[i * 2 + 1];
+		left.m_prevInput += deltaLeft;
+		right.m_prevInput += deltaRight;
+
+		if (out)
+		{
+			left.m_prevOutput = left.m_alpha * (left.m_prevOutput + deltaLeft);
+			right.m_prevOutput = right.m_alpha * (right.m_prevOutput + deltaRight);
+			out[i * 2] = left.m_prevOutput;
+			out[i * 2 + 1] = right.m_prevOutput;
+		}
+	}
+
+	RemoveSamples(count);
+}
+
+#if BAND_LIMITED_SYNTH_SSE || BAND_LIMITED_SYNTH_NEON
+
+// Two samples of both channels at a time. The second sample depends on the first one, y1 = a * (y0 + x1) & y2 = a * (y1 + x2),
+// which is unrolled into y2 = a * x2 + a^2 * x1 + a^2 * y0 so both only depend on the previous pair
+void BandLimitedSynth::ReadSamples(float* out, uint32_t count, HighPassFilter& left, HighPassFilter& right)
+{
+	if (!out || count < 2)
+	{
+		ReadSamplesScalar(out, count, left, right);
+		return;
+	}
+
+	const uint32_t pairs = count / 2;
+	const float alphaValues[4] = { left.m_alpha, right.m_alpha, left.m_alpha * left.m_alpha, right.m_alpha * right.m_alpha };
+	const float outputValues[4] = { left.m_prevOutput, right.m_prevOutput, left.m_prevOutput, right.m_prevOutput };
+	float inputSums[4];
+
+#if BAND_LIMITED_SYNTH_SSE
+	const __m128 alphas = _mm_loadu_ps(alphaValues);
+	const __m128 alpha = _mm_movelh_ps(alphas, alphas);
+	__m128 previous = _mm_loadu_ps(outputValues);
+	__m128 inputSum = _mm_setzero_ps();
+
+	for (uint32_t i = 0; i < pairs; ++i)
+	{
+		__m128 deltas = _mm_loadu_ps(m_buffer + i * 4);
+		inputSum = _mm_add_ps(inputSum, deltas);
+
+		__m128 scaled = _mm_mul_ps(deltas, alpha);
+		scaled = _mm_add_ps(scaled, _mm_mul_ps(_mm_movelh_ps(_mm_setzero_ps(), scaled), alpha));
+		__m128 filtered = _mm_add_ps(scaled, _mm_mul_ps(previous, alphas));
+
+		_mm_storeu_ps(out + i * 4, filtered);
+		previous = _mm_movehl_ps(filtered, filtered);
+	}
+
+	_mm_storeu_ps(inputSums, inputSum);
+	float lastOutputs[4];
+	_mm_storeu_ps(lastOutputs, previous);
+#else
+	const float32x4_t alphas = vld1q_f32(alphaValues);
+	const float32x4_t alpha = vcombine_f32(vget_low_f32(alphas), vget_low_f32(alphas));
+	float32x4_t previous = vld1q_f32(outputValues);
+	float32x4_t inputSum = vdupq_n_f32(0.0f);
+
+	for (uint32_t i = 0; i < pairs; ++i)
+	{
+		float32x4_t deltas = vld1q_f32(m_buffer + i * 4);
+		inputSum = vaddq_f32(inputSum, deltas);
+
+		float32x4_t scaled = vmulq_f32(deltas, alpha);
+		scaled = vmlaq_f32(scaled, vcombine_f32(vdup_n_f32(0.0f), vget_low_f32(scaled)), alpha);
+		float32x4_t filtered = vmlaq_f32(scaled, previous, alphas);
+
+		vst1q_f32(out + i * 4, filtered);
+		previous = vcombine_f32(vget_high_f32(filtered), vget_high_f32(filtered));
+	}
+
+	vst1q_f32(inputSums, inputSum);
+	float lastOutputs[4];
+	vst1q_f32(lastOutputs, previous);
+#endif
+
+	left.m_prevInput += inputSums[0] + inputSums[2];
+	right.m_prevInput += inputSums[1] + inputSums[3];
+	left.m_prevOutput = lastOutputs[0];
+	right.m_prevOutput = lastOutputs[1];
+
+	RemoveSamples(pairs * 2);
+	ReadSamplesScalar(out + pairs * 4, count - pairs * 2, left, right);
+}
+
+#else
+
+void BandLimitedSynth::ReadSamples(float* out, uint32_t count, HighPassFilter& left, HighPassFilter& right)
+{
+	ReadSamplesScalar(out, count, left, right);
+}
+
+#endif
+
+// Moves the samples still being added to back to the start of the buffer
+void BandLimitedSynth::RemoveSamples(uint32_t count)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	uint32_t end = (GetAvailableSamples() + BAND_LIMITED_SYNTH_TAPS) * 2;
+	uint32_t removed = count * 2;
+	for (uint32_t i = removed; i < end; ++i)
+	{
+		m_buffer[i - removed] = m_buffer[i];
+	}
+	memset_y(m_buffer + end - removed, 0, removed * sizeof(float));
+
+	m_offset -= static_cast<uint64_t>(count) << FIXED_POINT_SHIFT;
+}
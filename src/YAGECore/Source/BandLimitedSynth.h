@@ -0,0 +1,75 @@
+#pragma once
+#include "CppIncludes.h"
+
+// Width of a step in output samples, the output lags behind by half of it
+#define BAND_LIMITED_SYNTH_TAPS 16
+#define BAND_LIMITED_SYNTH_PHASE_BITS 6
+#define BAND_LIMITED_SYNTH_PHASES (1 << BAND_LIMITED_SYNTH_PHASE_BITS)
+// Output samples a single block can span
+#define BAND_LIMITED_SYNTH_CAPACITY 2048
+
+// 1 adds the steps and filters the output with SSE or NEON where the target has them, 0 one sample at a time
+#ifndef BAND_LIMITED_SYNTH_SIMD
+#define BAND_LIMITED_SYNTH_SIMD 1
+#endif
+
+// One pole high-pass filter that keeps the DC offset of the channels out of the output
+struct HighPassFilter
+{
+	HighPassFilter();
+
+	void SetParams(float cutoff, float sampleRate);
+
+	float m_alpha;
+	float m_prevOutput;
+	float m_prevInput;
+};
+
+// Turns the level changes of the channels into output samples. Every change is added at the t-cycle it happens as a band-limited step,
+// a windowed sinc for one of several sub-sample phases, so channels toggling faster than the output rate don't alias.
+// Only the changes are stored, the output is their running sum. That's what the high-pass filter takes the difference of anyway,
+// so the filter runs on them directly.
+class BandLimitedSynth
+{
+public:
+	BandLimitedSynth();
+
+	// The clock rate is in t-cycles per second, a sample rate of 0 turns the synth off
+	void SetRates(double clockRate, uint32_t sampleRate);
+	void Clear();
+
+	bool IsActive() const
+	{
+		return m_factor != 0;
+	}
+
+	// Longest block in t-cycles whose samples still fit in the buffer
+	uint32_t GetMaxBlockCycles() const;
+
+	// The time is in t-cycles since the start of the current block
+	void AddDelta(uint32_t time, float left, float right);
+	void EndBlock(uint32_t time);
+
+	// Samples no later change can affect anymore
+	uint32_t GetAvailableSamples() const
+	{
+		return static_cast<uint32_t>(m_offset >> 32);
+	}
+
+	// Writes count of the available samples as interleaved left & right through the filters and drops them from the buffer.
+	// Without an output they only get dropped
+	void ReadSamples(float* out, uint32_t count, HighPassFilter& left, HighPassFilter& right);
+	void ReadSamplesScalar(float* out, uint32_t count, HighPassFilter& left, HighPassFilter& right);
+
+private:
+	void BuildKernel();
+	void RemoveSamples(uint32_t count);
+
+	// Output samples per t-cycle & the end of the last block in samples since the start of the buffer, both 32.32 fixed point
+	uint64_t m_factor;
+	uint64_t m_offset;
+
+	// Every tap twice, once for each of the interleaved channels
+	float m_kernel[BAND_LIMITED_SYNTH_PHASES][BAND_LIMITED_SYNTH_TAPS * 2];
+	float m_buffer[(BAND_LIMITED_SYNTH_CAPACITY + BAND_LIMITED_SYNTH_TAPS) * 2];
+};
@@ -0,0 +1,117 @@
+#include "BlockCache.h"
+#include "Allocator.h"
+#include "InstructionTable.h"
+
+#define EXTENSION_OPCODE 0xCB
+
+namespace
+{
+#define BLOCK_CACHE_LENGTH_ENTRY(opcode, mnemonic, length, duration, func) length,
+	const uint8_t s_lengths[] = { INSTRUCTION_TABLE(BLOCK_CACHE_LENGTH_ENTRY) };
+#undef BLOCK_CACHE_LENGTH_ENTRY
+
+	// Anything that can move the PC somewhere else than the next instruction, or stop the CPU, ends a block
+	bool EndsBlock(uint8_t opcode)
+	{
+		if ((opcode & 0xC7) == 0xC7) // RST
+		{
+			return true;
+		}
+
+		switch (opcode)
+		{
+		case 0x18: case 0x20: case 0x28: case 0x30: case 0x38: // JR
+		case 0xC2: case 0xC3: case 0xCA: case 0xD2: case 0xDA: case 0xE9: // JP
+		case 0xC4: case 0xCC: case 0xCD: case 0xD4: case 0xDC: // CALL
+		case 0xC0: case 0xC8: case 0xC9: case 0xD0: case 0xD8: case 0xD9: // RET
+		case 0x10: case 0x76: // STOP, HALT
+		case 0xD3: case 0xDB: case 0xDD: case 0xE3: case 0xE4: case 0xEB: case 0xEC: case 0xED: case 0xF4: case 0xFC: case 0xFD: // Unassigned
+			return true;
+		default:
+			return false;
+		}
+	}
+}
+
+BlockCache::BlockCache(Allocator* allocator)
+	: m_allocator(allocator)
+	, m_next(nullptr)
+{
+	m_blocks = Y_NEW_A(m_allocator, Block, BLOCK_CACHE_BLOCK_COUNT);
+	memset_y(m_pages, 0, sizeof(m_pages));
+	InvalidateAll();
+}
+
+BlockCache::~BlockCache()
+{
+	Y_DELETE_A(m_allocator, m_blocks);
+}
+
+// Only needed when the memory behind a source pointer changes, e.g. when a new ROM is mapped
+void BlockCache::InvalidateAll()
+{
+	for (uint32_t i = 0; i < BLOCK_CACHE_BLOCK_COUNT; ++i)
+	{
+		m_blocks[i].m_source = nullptr;
+	}
+	m_next = nullptr;
+}
+
+const BlockCache::Instruction* BlockCache::FetchBlock(uint16_t pc)
+{
+	const uint8_t* page = m_pages[pc >> BLOCK_CACHE_PAGE_SHIFT];
+	if (page == nullptr)
+	{
+		m_next = nullptr;
+		return nullptr;
+	}
+
+	const uint8_t* source = page + (pc & (BLOCK_CACHE_PAGE_SIZE - 1));
+	uintptr_t key = reinterpret_cast<uintptr_t>(source);
+	Block& block = m_blocks[(key ^ (key >> 10)) & (BLOCK_CACHE_BLOCK_COUNT - 1)];
+	if (block.m_source != source || block.m_start != pc)
+	{
+		Decode(block, pc, source);
+	}
+
+	const Instruction* first = block.m_instructions;
+	m_next = first->m_isLast ? nullptr : first + 1;
+	return first;
+}
+
+void BlockCache::Decode(Block& block, uint16_t pc, const uint8_t* source)
+{
+	block.m_source = source;
+	block.m_start = pc;
+
+	// Instructions never cross the page, the next one might belong to a different bank
+	uint32_t available = BLOCK_CACHE_PAGE_SIZE - (pc & (BLOCK_CACHE_PAGE_SIZE - 1));
+	uint32_t offset = 0;
+	uint32_t count = 0;
+	while (true)
+	{
+		uint8_t opcode = source[offset];
+		uint32_t length = opcode == EXTENSION_OPCODE ? 2 : s_lengths[opcode];
+		uint32_t entries = opcode == EXTENSION_OPCODE ? 2 : 1;
+
+		// The first instruction is always decoded so a block is never empty, a CB prefix at the end of the page is fetched from the bus
+		if (count > 0 && (offset + length > available || count + entries > BLOCK_CACHE_MAX_BLOCK_LENGTH))
+		{
+			break;
+		}
+
+		block.m_instructions[count++] = { static_cast<uint16_t>(pc + offset), opcode, false };
+		if (entries == 2 && offset + 1 < available)
+		{
+			block.m_instructions[count++] = { static_cast<uint16_t>(pc + offset + 1), source[offset + 1], false };
+		}
+		offset += length;
+
+		if (EndsBlock(opcode) || offset >= available || count >= BLOCK_CACHE_MAX_BLOCK_LENGTH)
+		{
+			break;
+		}
+	}
+
+	block.m_instructions[count - 1].m_isLast = true;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "CppIncludes.h"
+
+// Off by default, fetching through the page table is cheaper than walking the blocks, see FetchBenchmark
+#ifndef CPU_BLOCK_CACHE
+#define CPU_BLOCK_CACHE 0
+#endif
+
+// Only the cartridge ROM (and the bootrom mapped over it) is cached, its content never changes
+#define BLOCK_CACHE_ADDRESS_COUNT 0x8000
+#define BLOCK_CACHE_PAGE_SHIFT 8
+#define BLOCK_CACHE_PAGE_SIZE 0x100
+#define BLOCK_CACHE_PAGE_COUNT (BLOCK_CACHE_ADDRESS_COUNT >> BLOCK_CACHE_PAGE_SHIFT)
+#define BLOCK_CACHE_BLOCK_COUNT 1024
+#define BLOCK_CACHE_MAX_BLOCK_LENGTH 16
+
+class Allocator;
+
+// Straight-line runs of ROM code decoded once, up to the next control flow instruction or the end of the page.
+// Blocks are keyed by the source of their first byte, which is the active ROM bank and PC, so they stay valid across bank switches.
+// The CPU walks a block with a cursor and only looks one up again after a jump, a bank switch or code running from RAM.
+class BlockCache
+{
+public:
+	struct Instruction
+	{
+		uint16_t m_pc;
+		// Raw byte, the operand of a CB prefix gets its own entry
+		uint8_t m_opcode;
+		bool m_isLast;
+	};
+
+	BlockCache(Allocator* allocator);
+	~BlockCache();
+
+	// Called for every ROM page whenever the page table is refreshed, nullptr takes the page out of the cache
+	void MapPage(uint32_t page, const uint8_t* source)
+	{
+		if (m_pages[page] != source)
+		{
+			m_pages[page] = source;
+			m_next = nullptr;
+		}
+	}
+
+	void InvalidateAll();
+
+	// nullptr when pc is not backed by the cache, the byte has to be read from the bus
+	const Instruction* Fetch(uint16_t pc)
+	{
+		if (pc >= BLOCK_CACHE_ADDRESS_COUNT)
+		{
+			return nullptr;
+		}
+
+		const Instruction* next = m_next;
+		if (next != nullptr && next->m_pc == pc)
+		{
+			m_next = next->m_isLast ? nullptr : next + 1;
+			return next;
+		}
+
+		return FetchBlock(pc);
+	}
+
+private:
+	struct Block
+	{
+		const uint8_t* m_source;
+		uint16_t m_start;
+		Instruction m_instructions[BLOCK_CACHE_MAX_BLOCK_LENGTH];
+	};
+
+	const Instruction* FetchBlock(uint16_t pc);
+	void Decode(Block& block, uint16_t pc, const uint8_t* source);
+
+	Allocator* m_allocator;
+	Block* m_blocks;
+	const Instruction* m_next;
+	const uint8_t* m_pages[BLOCK_CACHE_PAGE_COUNT];
+};
@@ -11,10 +11,10 @@
 class CPU : ISerializable
 {
 public:
-	CPU();
-	explicit CPU(bool enableInterruptHandling);
-	explicit CPU(GamestateSerializer* serializer);
-	CPU(GamestateSerializer* serializer, bool enableInterruptHandling);
+	explicit CPU(Allocator* allocator);
+	CPU(Allocator* allocator, bool enableInterruptHandling);
+	CPU(Allocator* allocator, GamestateSerializer* serializer);
+	CPU(Allocator* allocator, GamestateSerializer* serializer, bool enableInterruptHandling);
 	~CPU();
 
 #if _DEBUG
@@ -40,7 +40,15 @@ public:
 		return m_registers;
 	}
 #endif
+	// Instrumented steps run the debug callbacks and stop instructions, uninstrumented ones skip them entirely
+	template<bool instrumented>
 	bool Step(Memory& memory);
+	bool HasDebugHooks() const;
+	bool IsWaitingForInterrupt(Memory& memory) const;
+	// True once per arrival at the head of a polling loop, which is a repeat if the previous iteration left all registers unchanged
+	bool TakePollingLoopArrival();
+	bool IsPollingLoopRepeat() const;
+	void SkipPollingLoopIterations(uint64_t iterations);
 
 	void SetProgramCounter(unsigned short addr);
 
@@ -48,7 +56,7 @@ public:
 	void ResetToBootromValues();
 
 private:
-	typedef InstructionResult (*InstructionFunc)(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory);
+	typedef InstructionResult (*InstructionFunc)(InstructionTempData& data, Registers* registers, Memory& memory);
 
 	struct Instruction
 	{
@@ -59,8 +67,13 @@ private:
 	};
 
 	void ClearRegisters();
+	template<bool instrumented>
 	bool ExecuteInstruction(Memory& memory);
+	template<bool instrumented>
 	bool DecodeAndFetchNext(Memory& memory);
+	bool ProcessDebugHooks(Memory& memory);
+	void DetectPollingLoop(uint16_t atPC, Memory& memory);
+	bool IsPollingLoopBody(uint16_t head, uint16_t end, Memory& memory, uint8_t& instructionCount, uint8_t& decodeCount) const;
 	bool ProcessInterrupts(Memory& memory);
 	bool CheckForWakeup(Memory& memory, bool postFetch);
 
@@ -68,6 +81,7 @@ private:
 	void Deserialize(const uint8_t* data) override;
 	virtual uint32_t GetSerializationSize() override;
 
+	Allocator* m_allocator;
 	Registers m_registers;
 
 	const Instruction m_instructions[INSTRUCTION_SET_SIZE + 1];
@@ -75,10 +89,22 @@ private:
 	bool m_delayedInterruptHandling;
 	const bool m_InterruptHandlingEnabled;
 
-	const Instruction* m_currentInstruction;
 	InstructionTempData m_instructionTempData;
 	bool m_isNextInstructionCB;
 
+	struct PollingLoop
+	{
+		uint16_t m_head;
+		uint16_t m_end;
+		uint8_t m_instructionCount;
+		uint8_t m_decodesSinceArrival;
+		Registers m_registers;
+	};
+
+	PollingLoop m_pollingLoop;
+	bool m_pollingLoopArrival;
+	bool m_pollingLoopRepeat;
+
 #if _DEBUG
 
 	std::map<uint16_t, Emulator::DebugCallback> DEBUG_PCCallbackMap;
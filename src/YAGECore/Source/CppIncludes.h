@@ -14,13 +14,17 @@
 #include <utility>
 
 #include <string.h>
+#include <stddef.h>
 #include <cmath>
 
 #define memcpy_y memcpy
 #define memset_y memset
 #define strlen_y strlen
 #define pow_y pow
+#define sin_y sin
+#define cos_y cos
 #define abs_y abs
+#define offsetof_y offsetof
 
 #else
 
@@ -30,6 +34,7 @@
 #define memset_y __builtin_memset
 #define strlen_y __builtin_strlen
 #define abs_y __builtin_abs
+#define offsetof_y __builtin_offsetof
 
 inline uint32_t pow_y( uint32_t base, uint32_t exponent )
 {
@@ -41,6 +46,44 @@ inline uint32_t pow_y( uint32_t base, uint32_t exponent )
 	return result;
 }
 
+// Taylor series after folding x into [-pi/2, pi/2], precise enough for tables built once at startup
+inline double sin_y(double x)
+{
+	const double pi = 3.14159265358979323846;
+	while (x > pi)
+	{
+		x -= 2.0 * pi;
+	}
+	while (x < -pi)
+	{
+		x += 2.0 * pi;
+	}
+
+	if (x > pi / 2.0)
+	{
+		x = pi - x;
+	}
+	else if (x < -pi / 2.0)
+	{
+		x = -pi - x;
+	}
+
+	double square = x * x;
+	double term = x;
+	double sum = x;
+	for (uint32_t i = 1; i < 10; ++i)
+	{
+		term *= -square / static_cast<double>((2 * i) * (2 * i + 1));
+		sum += term;
+	}
+	return sum;
+}
+
+inline double cos_y(double x)
+{
+	return sin_y(x + 3.14159265358979323846 / 2.0);
+}
+
 inline void* operator new(size_t /* count */, void* ptr) noexcept
 {
 	return ptr;
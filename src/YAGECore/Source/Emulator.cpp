@@ -4,14 +4,30 @@
 
 Emulator* Emulator::Create(YAGEAllocFunc allocFunc, YAGEFreeFunc freeFunc)
 {
-	Allocator::Initialize(allocFunc, freeFunc);
-	return Y_NEW(VirtualMachine);
+	Allocator* allocator = Allocator::Create(allocFunc, freeFunc);
+	if (!allocator)
+	{
+		LOG_ERROR("Could not allocate emulator memory");
+		return nullptr;
+	}
+	return Y_NEW(allocator, VirtualMachine, allocator);
 }
 
 void Emulator::Delete(Emulator* emulator)
 {
-	Y_DELETE(emulator);
-	Allocator::FreeAll();
+	if (!emulator)
+	{
+		return;
+	}
+
+	Allocator* allocator = emulator->m_allocator;
+	Y_DELETE(allocator, emulator);
+	Allocator::Destroy(allocator);
+}
+
+Emulator::Emulator(Allocator* allocator)
+	: m_allocator(allocator)
+{
 }
 
 Emulator::~Emulator()
@@ -20,5 +36,5 @@ Emulator::~Emulator()
 
 uint32_t Emulator::GetMemoryUse() const
 {
-	return Allocator::GetInstance().GetMemoryUse();
+	return m_allocator->GetMemoryUse();
 }
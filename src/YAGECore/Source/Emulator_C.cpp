@@ -80,18 +80,50 @@ extern "C" void Step(EmulatorCHandle emulator, EmulatorInputState inputState, do
 	emu->Step(state, deltaMs, false);
 }
 
+extern "C" uint64_t RunCycles(EmulatorCHandle emulator, EmulatorInputState inputState, uint64_t tCycles)
+{
+	Emulator* emu = FromHandle(emulator);
+	EmulatorInputs::InputState state{ inputState.m_dPad, inputState.m_buttons };
+	return emu->RunCycles(state, tCycles);
+}
+
+extern "C" uint64_t RunUntilVBlank(EmulatorCHandle emulator, EmulatorInputState inputState)
+{
+	Emulator* emu = FromHandle(emulator);
+	EmulatorInputs::InputState state{ inputState.m_dPad, inputState.m_buttons };
+	return emu->RunUntilVBlank(state);
+}
+
 extern "C" const void* GetFrameBuffer(EmulatorCHandle emulator)
 {
 	Emulator* emu = FromHandle(emulator);
 	return emu->GetFrameBuffer();
 }
 
+extern "C" void SetFrameBuffer(EmulatorCHandle emulator, void* buffer, uint32_t stride, EmulatorSettings_PixelFormat format)
+{
+	Emulator* emu = FromHandle(emulator);
+	emu->SetFrameBuffer(buffer, stride, static_cast<EmulatorSettings::PixelFormat>(format));
+}
+
+extern "C" void SetFrameReadyCallback(EmulatorCHandle emulator, EmulatorFrameReadyCallback callback, void* userData)
+{
+	Emulator* emu = FromHandle(emulator);
+	emu->SetFrameReadyCallback(callback, userData);
+}
+
 extern "C" uint32_t GetNumberOfGeneratedSamples(EmulatorCHandle emulator)
 {
 	Emulator* emu = FromHandle(emulator);
 	return emu->GetNumberOfGeneratedSamples();
 }
 
+extern "C" uint64_t GetSkippedPollingCycles(EmulatorCHandle emulator)
+{
+	Emulator* emu = FromHandle(emulator);
+	return emu->GetSkippedPollingCycles();
+}
+
 extern "C" SerializationView Serialize(EmulatorCHandle emulator, uint8_t rawData)
 {
 	Emulator* emu = FromHandle(emulator);
@@ -110,6 +142,30 @@ extern "C" void SetTurboSpeed(EmulatorCHandle emulator, float speed)
 	emu->SetTurboSpeed(speed);
 }
 
+extern "C" void SetAudioRateAdjustment(EmulatorCHandle emulator, float ratio)
+{
+	Emulator* emu = FromHandle(emulator);
+	emu->SetAudioRateAdjustment(ratio);
+}
+
+extern "C" void SetAudioEnabled(EmulatorCHandle emulator, uint8_t enabled)
+{
+	Emulator* emu = FromHandle(emulator);
+	emu->SetAudioEnabled(enabled != 0);
+}
+
+extern "C" void SetPPUAccuracy(EmulatorCHandle emulator, EmulatorSettings_PPUAccuracy accuracy)
+{
+	Emulator* emu = FromHandle(emulator);
+	emu->SetPPUAccuracy(static_cast<EmulatorSettings::PPUAccuracy>(accuracy));
+}
+
+extern "C" void SetRenderInterval(EmulatorCHandle emulator, uint32_t interval)
+{
+	Emulator* emu = FromHandle(emulator);
+	emu->SetRenderInterval(interval);
+}
+
 #if _DEBUG
 
 extern "C" void SetInstructionCallback(EmulatorCHandle emulator, uint8_t instr, EmulatorDebugCallback callback, void* userData)
@@ -0,0 +1,123 @@
+#include "FrameOutput.h"
+#include "Logging.h"
+#include "Helpers.h"
+
+#define SHADE_COUNT 4
+#define SHADES_PER_PACKED_BYTE 4
+
+FrameOutput::FrameOutput()
+	: m_target(nullptr)
+	, m_stride(0)
+	, m_format(EmulatorSettings::PixelFormat::RGBA8888)
+	, m_palette()
+{
+}
+
+bool FrameOutput::SetTarget(void* buffer, uint32_t stride, EmulatorSettings::PixelFormat format, const RGBA* shadeColors)
+{
+	uint32_t lineSize = GetLineSize(format);
+	if (lineSize == 0)
+	{
+		LOG_ERROR(string_format("Unknown pixel format %u", static_cast<uint32_t>(format)).c_str());
+		return false;
+	}
+	if (stride < lineSize)
+	{
+		LOG_ERROR(string_format("Frame buffer stride %u is smaller than a line of %u bytes", stride, lineSize).c_str());
+		return false;
+	}
+
+	for (uint32_t i = 0; i < SHADE_COUNT; ++i)
+	{
+		const RGBA& color = shadeColors[i];
+		switch (format)
+		{
+		case EmulatorSettings::PixelFormat::RGBA8888:
+			memcpy_y(&m_palette[i], &color, sizeof(RGBA));
+			break;
+		case EmulatorSettings::PixelFormat::XRGB8888:
+			m_palette[i] = 0xFF000000 | (color.r << 16) | (color.g << 8) | color.b;
+			break;
+		case EmulatorSettings::PixelFormat::RGB565:
+			m_palette[i] = ((color.r >> 3) << 11) | ((color.g >> 2) << 5) | (color.b >> 3);
+			break;
+		default:
+			m_palette[i] = i;
+			break;
+		}
+	}
+
+	m_target = static_cast<uint8_t*>(buffer);
+	m_stride = stride;
+	m_format = format;
+	return true;
+}
+
+void FrameOutput::SetBuffer(void* buffer)
+{
+	m_target = static_cast<uint8_t*>(buffer);
+}
+
+void* FrameOutput::GetTarget() const
+{
+	return m_target;
+}
+
+void FrameOutput::WriteLine(uint32_t lineY, const uint8_t* shades)
+{
+	uint8_t* line = m_target + lineY * m_stride;
+	switch (m_format)
+	{
+	case EmulatorSettings::PixelFormat::RGBA8888:
+	case EmulatorSettings::PixelFormat::XRGB8888:
+		for (uint32_t x = 0; x < EmulatorConstants::SCREEN_WIDTH; ++x)
+		{
+			memcpy_y(line + x * sizeof(uint32_t), &m_palette[shades[x]], sizeof(uint32_t));
+		}
+		break;
+	case EmulatorSettings::PixelFormat::RGB565:
+		for (uint32_t x = 0; x < EmulatorConstants::SCREEN_WIDTH; ++x)
+		{
+			uint16_t pixel = static_cast<uint16_t>(m_palette[shades[x]]);
+			memcpy_y(line + x * sizeof(uint16_t), &pixel, sizeof(uint16_t));
+		}
+		break;
+	case EmulatorSettings::PixelFormat::Indexed8:
+		memcpy_y(line, shades, EmulatorConstants::SCREEN_WIDTH);
+		break;
+	case EmulatorSettings::PixelFormat::Packed2bpp:
+		for (uint32_t x = 0; x < EmulatorConstants::SCREEN_WIDTH; x += SHADES_PER_PACKED_BYTE)
+		{
+			line[x / SHADES_PER_PACKED_BYTE] = static_cast<uint8_t>((shades[x] << 6) | (shades[x + 1] << 4) | (shades[x + 2] << 2) | shades[x + 3]);
+		}
+		break;
+	}
+}
+
+void FrameOutput::Clear(uint8_t shade)
+{
+	uint8_t shades[EmulatorConstants::SCREEN_WIDTH];
+	memset_y(shades, shade, sizeof(shades));
+	for (uint32_t y = 0; y < EmulatorConstants::SCREEN_HEIGHT; ++y)
+	{
+		WriteLine(y, shades);
+	}
+}
+
+uint32_t FrameOutput::GetLineSize(EmulatorSettings::PixelFormat format)
+{
+	switch (format)
+	{
+	case EmulatorSettings::PixelFormat::RGBA8888:
+	case EmulatorSettings::PixelFormat::XRGB8888:
+		return EmulatorConstants::SCREEN_WIDTH * sizeof(uint32_t);
+	case EmulatorSettings::PixelFormat::RGB565:
+		return EmulatorConstants::SCREEN_WIDTH * sizeof(uint16_t);
+	case EmulatorSettings::PixelFormat::Indexed8:
+		return EmulatorConstants::SCREEN_WIDTH;
+	case EmulatorSettings::PixelFormat::Packed2bpp:
+		return EmulatorConstants::SCREEN_WIDTH / SHADES_PER_PACKED_BYTE;
+	default:
+		return 0;
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "CppIncludes.h"
+#include "../Include/Emulator.h"
+
+struct RGBA
+{
+	uint8_t r;
+	uint8_t g;
+	uint8_t b;
+	uint8_t a;
+
+	bool operator==(const RGBA& other)
+	{
+		return r == other.r && g == other.g && b == other.b && a == other.a;
+	}
+};
+
+// Writes finished scanlines, one shade per pixel, into a frame buffer in the pixel format it is presented in
+class FrameOutput
+{
+public:
+	FrameOutput();
+
+	// Fails if the stride can't hold a line in the given format
+	bool SetTarget(void* buffer, uint32_t stride, EmulatorSettings::PixelFormat format, const RGBA* shadeColors);
+	// Keeps stride & format
+	void SetBuffer(void* buffer);
+	void* GetTarget() const;
+
+	void WriteLine(uint32_t lineY, const uint8_t* shades);
+	void Clear(uint8_t shade);
+
+	static uint32_t GetLineSize(EmulatorSettings::PixelFormat format);
+
+private:
+	uint8_t* m_target;
+	uint32_t m_stride;
+	EmulatorSettings::PixelFormat m_format;
+	// The four shades already converted to the target format
+	uint32_t m_palette[4];
+};
@@ -26,7 +26,7 @@ yString string_format(const char* fmt, Args ... args)
 #else
 
 template<typename ... Args>
-yString string_format(const char* fmt, Args ... args)
+yString string_format(const char* fmt, Args ...)
 {
     return yString(fmt);
 }
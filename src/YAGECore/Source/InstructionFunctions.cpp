@@ -1,6 +1,7 @@
 #include "InstructionFunctions.h"
 #include "Helpers.h"
 #include "Interrupts.h"
+#include "InstructionTable.h"
 
 namespace InstructionFunctions
 {
@@ -55,12 +56,9 @@ namespace InstructionFunctions
 			registers->SetFlag(Registers::Flags::h, halfCarry);
 		}
 
-		void SetFlagsNoCarry(uint8_t previousReg, uint8_t operand, uint8_t result, bool subtract, Registers* registers)
+		void SetFlagsNoCarry(uint8_t previousReg, uint8_t operand, bool subtract, Registers* registers)
 		{
-			SetZeroFlag(result, registers);
-
-			SetHalfCarryFlag(previousReg, operand, subtract, registers);
-			registers->SetFlag(Registers::Flags::n, subtract);
+			registers->SetPendingFlags(subtract ? Registers::PendingFlags::Dec : Registers::PendingFlags::Inc, previousReg, operand);
 		}
 
 		void SetCarry(uint8_t previousReg, uint8_t operand, Registers* registers, bool subtract)
@@ -69,10 +67,9 @@ namespace InstructionFunctions
 			registers->SetFlag(Registers::Flags::cy, carry);
 		}
 
-		void SetFlags(uint8_t previousReg, uint8_t operand, uint8_t result, bool subtract, Registers* registers)
+		void SetFlags(uint8_t previousReg, uint8_t operand, bool subtract, Registers* registers)
 		{
-			SetCarry(previousReg, operand, registers, subtract);
-			SetFlagsNoCarry(previousReg, operand, result, subtract, registers);
+			registers->SetPendingFlags(subtract ? Registers::PendingFlags::Sub : Registers::PendingFlags::Add, previousReg, operand);
 		}
 
 		void SetFlags16(uint16_t previousReg, uint16_t operand, Registers* registers)
@@ -90,14 +87,14 @@ namespace InstructionFunctions
 		{
 			uint8_t prevReg = operand1;
 			operand1 += operand2;
-			SetFlags(prevReg, operand2, operand1, false, registers);
+			SetFlags(prevReg, operand2, false, registers);
 		}
 
 		void Subtraction(uint8_t& operand1, uint8_t operand2, Registers* registers)
 		{
 			uint8_t prevReg = operand1;
 			operand1 -= operand2;
-			SetFlags(prevReg, operand2, operand1, true, registers);
+			SetFlags(prevReg, operand2, true, registers);
 		}
 
 		void CompareSubtraction(uint8_t operand1, uint8_t operand2, Registers* registers)
@@ -131,28 +128,19 @@ namespace InstructionFunctions
 		void BitwiseAnd(uint8_t& operand1, uint8_t operand2, Registers* registers)
 		{
 			operand1 = operand1 & operand2;
-			SetZeroFlag(operand1, registers);
-			registers->SetFlag(Registers::Flags::h);
-			registers->ResetFlag(Registers::Flags::n);
-			registers->ResetFlag(Registers::Flags::cy);
+			registers->SetPendingFlags(Registers::PendingFlags::And, operand1, 0);
 		}
 
 		void BitwiseXor(uint8_t& operand1, uint8_t operand2, Registers* registers)
 		{
 			operand1 = operand1 ^ operand2;
-			SetZeroFlag(operand1, registers);
-			registers->ResetFlag(Registers::Flags::h);
-			registers->ResetFlag(Registers::Flags::n);
-			registers->ResetFlag(Registers::Flags::cy);
+			registers->SetPendingFlags(Registers::PendingFlags::Or, operand1, 0);
 		}
 
 		void BitwiseOr(uint8_t& operand1, uint8_t operand2, Registers* registers)
 		{
 			operand1 = operand1 | operand2;
-			SetZeroFlag(operand1, registers);
-			registers->ResetFlag(Registers::Flags::h);
-			registers->ResetFlag(Registers::Flags::n);
-			registers->ResetFlag(Registers::Flags::cy);
+			registers->SetPendingFlags(Registers::PendingFlags::Or, operand1, 0);
 		}
 
 		InstructionResult Call(uint16_t addr, uint8_t cycle, Registers* registers, Memory& memory)
@@ -323,18 +311,18 @@ namespace InstructionFunctions
 
 
 
-InstructionResult InstructionFunctions::UNIMPLEMENTED(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::UNIMPLEMENTED(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	LOG_ERROR("Instruction not implemented");
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::NOP(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::NOP(InstructionTempData& data, Registers* registers, Memory& memory)
 {	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SCF(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SCF(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->ResetFlag(Registers::Flags::h);
 	registers->ResetFlag(Registers::Flags::n);
@@ -343,7 +331,7 @@ InstructionResult InstructionFunctions::SCF(const char* mnemonic, InstructionTem
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CCF(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CCF(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->ResetFlag(Registers::Flags::h);
 	registers->ResetFlag(Registers::Flags::n);
@@ -352,7 +340,7 @@ InstructionResult InstructionFunctions::CCF(const char* mnemonic, InstructionTem
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JR_NZ_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JR_NZ_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -369,7 +357,7 @@ InstructionResult InstructionFunctions::JR_NZ_n(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JR_Z_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JR_Z_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -386,7 +374,7 @@ InstructionResult InstructionFunctions::JR_Z_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JR_NC_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JR_NC_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -403,7 +391,7 @@ InstructionResult InstructionFunctions::JR_NC_n(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JR_C_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JR_C_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -420,7 +408,7 @@ InstructionResult InstructionFunctions::JR_C_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JR_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JR_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -436,7 +424,7 @@ InstructionResult InstructionFunctions::JR_n(const char* mnemonic, InstructionTe
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JP_NZ_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JP_NZ_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -458,7 +446,7 @@ InstructionResult InstructionFunctions::JP_NZ_nn(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JP_Z_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JP_Z_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -480,7 +468,7 @@ InstructionResult InstructionFunctions::JP_Z_nn(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JP_NC_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JP_NC_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -502,7 +490,7 @@ InstructionResult InstructionFunctions::JP_NC_nn(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JP_C_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JP_C_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -524,7 +512,7 @@ InstructionResult InstructionFunctions::JP_C_nn(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JP_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JP_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -547,13 +535,13 @@ InstructionResult InstructionFunctions::JP_nn(const char* mnemonic, InstructionT
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::JP_HL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::JP_HL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->PC = registers->HL;
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CALL_NZ_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CALL_NZ_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -574,7 +562,7 @@ InstructionResult InstructionFunctions::CALL_NZ_nn(const char* mnemonic, Instruc
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CALL_Z_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CALL_Z_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -595,7 +583,7 @@ InstructionResult InstructionFunctions::CALL_Z_nn(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CALL_NC_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CALL_NC_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -616,7 +604,7 @@ InstructionResult InstructionFunctions::CALL_NC_nn(const char* mnemonic, Instruc
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CALL_C_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CALL_C_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -637,7 +625,7 @@ InstructionResult InstructionFunctions::CALL_C_nn(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CALL_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CALL_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -654,47 +642,47 @@ InstructionResult InstructionFunctions::CALL_nn(const char* mnemonic, Instructio
 	return Call(data.m_tmp_16, data.m_cycles - 2, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RST_00(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RST_00(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Call(0x00, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RST_10(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RST_10(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Call(0x10, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RST_20(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RST_20(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Call(0x20, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RST_30(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RST_30(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Call(0x30, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RST_08(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RST_08(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Call(0x08, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RST_18(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RST_18(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Call(0x18, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RST_28(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RST_28(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Call(0x28, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RST_38(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RST_38(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Call(0x38, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::RET_NZ(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RET_NZ(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -719,7 +707,7 @@ InstructionResult InstructionFunctions::RET_NZ(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RET_Z(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RET_Z(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -744,7 +732,7 @@ InstructionResult InstructionFunctions::RET_Z(const char* mnemonic, InstructionT
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RET_NC(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RET_NC(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -769,7 +757,7 @@ InstructionResult InstructionFunctions::RET_NC(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RET_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RET_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -794,7 +782,7 @@ InstructionResult InstructionFunctions::RET_C(const char* mnemonic, InstructionT
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RET(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RET(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -811,7 +799,7 @@ InstructionResult InstructionFunctions::RET(const char* mnemonic, InstructionTem
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RETI(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RETI(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -829,26 +817,26 @@ InstructionResult InstructionFunctions::RETI(const char* mnemonic, InstructionTe
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::EI(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::EI(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DI(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DI(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->IMEF = false;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::HALT(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::HALT(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->CpuState = Registers::State::Halt;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::STOP(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::STOP(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->PC++;
 	registers->CpuState = Registers::State::Stop;
@@ -860,7 +848,7 @@ InstructionResult InstructionFunctions::STOP(const char* mnemonic, InstructionTe
 
 //8 bit loads 
 //-------------------------------------------------------------------------------------------------
-InstructionResult InstructionFunctions::LD_mBC_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mBC_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
  	if (data.m_cycles == 0)
 	{
@@ -871,7 +859,7 @@ InstructionResult InstructionFunctions::LD_mBC_A(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mDE_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mDE_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -882,7 +870,7 @@ InstructionResult InstructionFunctions::LD_mDE_A(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHLinc_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHLinc_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -893,7 +881,7 @@ InstructionResult InstructionFunctions::LD_mHLinc_A(const char* mnemonic, Instru
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHLdec_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHLdec_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -904,7 +892,7 @@ InstructionResult InstructionFunctions::LD_mHLdec_A(const char* mnemonic, Instru
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -917,7 +905,7 @@ InstructionResult InstructionFunctions::LD_B_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -930,7 +918,7 @@ InstructionResult InstructionFunctions::LD_D_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -943,7 +931,7 @@ InstructionResult InstructionFunctions::LD_H_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHL_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHL_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -959,7 +947,7 @@ InstructionResult InstructionFunctions::LD_mHL_n(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -972,7 +960,7 @@ InstructionResult InstructionFunctions::LD_C_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -985,7 +973,7 @@ InstructionResult InstructionFunctions::LD_E_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -998,7 +986,7 @@ InstructionResult InstructionFunctions::LD_L_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1011,49 +999,49 @@ InstructionResult InstructionFunctions::LD_A_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->B = registers->B;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->B = registers->C;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->B = registers->D;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->B = registers->E;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->B = registers->H;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->B = registers->L;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1066,56 +1054,56 @@ InstructionResult InstructionFunctions::LD_B_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_B_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_B_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->B = registers->A;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->C = registers->B;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->C = registers->C;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->C = registers->D;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->C = registers->E;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->C = registers->H;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->C = registers->L;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1128,56 +1116,56 @@ InstructionResult InstructionFunctions::LD_C_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_C_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_C_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->C = registers->A;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->D = registers->B;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->D = registers->C;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->D = registers->D;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->D = registers->E;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->D = registers->H;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->D = registers->L;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1190,56 +1178,56 @@ InstructionResult InstructionFunctions::LD_D_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_D_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_D_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->D = registers->A;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->E = registers->B;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->E = registers->C;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->E = registers->D;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->E = registers->E;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->E = registers->H;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->E = registers->L;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1252,56 +1240,56 @@ InstructionResult InstructionFunctions::LD_E_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_E_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_E_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->E = registers->A;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->H = registers->B;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->H = registers->C;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->H = registers->D;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->H = registers->E;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->H = registers->H;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->H = registers->L;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1314,56 +1302,56 @@ InstructionResult InstructionFunctions::LD_H_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_H_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_H_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->H = registers->A;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->L = registers->B;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->L = registers->C;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->L = registers->D;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->L = registers->E;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->L = registers->H;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->L = registers->L;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1376,14 +1364,14 @@ InstructionResult InstructionFunctions::LD_L_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_L_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_L_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->L = registers->A;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHL_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHL_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1394,7 +1382,7 @@ InstructionResult InstructionFunctions::LD_mHL_B(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHL_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHL_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1405,7 +1393,7 @@ InstructionResult InstructionFunctions::LD_mHL_C(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHL_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHL_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1416,7 +1404,7 @@ InstructionResult InstructionFunctions::LD_mHL_D(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHL_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHL_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1427,7 +1415,7 @@ InstructionResult InstructionFunctions::LD_mHL_E(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHL_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHL_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1438,7 +1426,7 @@ InstructionResult InstructionFunctions::LD_mHL_H(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHL_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHL_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1449,7 +1437,7 @@ InstructionResult InstructionFunctions::LD_mHL_L(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mHL_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mHL_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1460,49 +1448,49 @@ InstructionResult InstructionFunctions::LD_mHL_A(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->A = registers->B;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->A = registers->C;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->A = registers->D;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->A = registers->E;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->A = registers->H;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->A = registers->L;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1515,14 +1503,14 @@ InstructionResult InstructionFunctions::LD_A_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->A = registers->A;
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_mBC(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_mBC(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1535,7 +1523,7 @@ InstructionResult InstructionFunctions::LD_A_mBC(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_mDE(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_mDE(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1548,7 +1536,7 @@ InstructionResult InstructionFunctions::LD_A_mDE(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_mHLinc(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_mHLinc(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1561,7 +1549,7 @@ InstructionResult InstructionFunctions::LD_A_mHLinc(const char* mnemonic, Instru
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_mHLdec(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_mHLdec(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1574,7 +1562,7 @@ InstructionResult InstructionFunctions::LD_A_mHLdec(const char* mnemonic, Instru
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LDH_mn_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LDH_mn_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1591,7 +1579,7 @@ InstructionResult InstructionFunctions::LDH_mn_A(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LDH_A_mn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LDH_A_mn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1608,7 +1596,7 @@ InstructionResult InstructionFunctions::LDH_A_mn(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LDH_mC_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LDH_mC_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1620,7 +1608,7 @@ InstructionResult InstructionFunctions::LDH_mC_A(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LDH_A_mC(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LDH_A_mC(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1632,7 +1620,7 @@ InstructionResult InstructionFunctions::LDH_A_mC(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mnn_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mnn_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1655,7 +1643,7 @@ InstructionResult InstructionFunctions::LD_mnn_A(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_A_mnn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_A_mnn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1680,38 +1668,38 @@ InstructionResult InstructionFunctions::LD_A_mnn(const char* mnemonic, Instructi
 
 //8 bit arithmatic/logic 
 //-------------------------------------------------------------------------------------------------
-InstructionResult InstructionFunctions::INC_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->B;
 	uint8_t prevReg = reg;
 	reg++;
-	SetFlagsNoCarry(prevReg, 1, reg, false, registers);
+	SetFlagsNoCarry(prevReg, 1, false, registers);
 
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->D;
 	uint8_t prevReg = reg;
 	reg++;
-	SetFlagsNoCarry(prevReg, 1, reg, false, registers);
+	SetFlagsNoCarry(prevReg, 1, false, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->H;
 	uint8_t prevReg = reg;
 	reg++;
-	SetFlagsNoCarry(prevReg, 1, reg, false, registers);
+	SetFlagsNoCarry(prevReg, 1, false, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1722,88 +1710,88 @@ InstructionResult InstructionFunctions::INC_mHL(const char* mnemonic, Instructio
 	{
 		uint8_t reg = data.m_tmp_u8 + 1;
 		memory.Write(registers->HL, reg);
-		SetFlagsNoCarry(data.m_tmp_u8, 1, reg, false, registers);
+		SetFlagsNoCarry(data.m_tmp_u8, 1, false, registers);
 		return InstructionResult::Continue;
 	}
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->C;
 	uint8_t prevReg = reg;
 	reg++;
-	SetFlagsNoCarry(prevReg, 1, reg, false, registers);
+	SetFlagsNoCarry(prevReg, 1, false, registers);
 
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->E;
 	uint8_t prevReg = reg;
 	reg++;
-	SetFlagsNoCarry(prevReg, 1, reg, false, registers);
+	SetFlagsNoCarry(prevReg, 1, false, registers);
 
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->L;
 	uint8_t prevReg = reg;
 	reg++;
-	SetFlagsNoCarry(prevReg, 1, reg, false, registers);
+	SetFlagsNoCarry(prevReg, 1, false, registers);
 
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->A;
 	uint8_t prevReg = reg;
 	reg++;
-	SetFlagsNoCarry(prevReg, 1, reg, false, registers);
+	SetFlagsNoCarry(prevReg, 1, false, registers);
 
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->B;
 	uint8_t prevReg = reg;
 	reg--;
-	SetFlagsNoCarry(prevReg, 1, reg, true, registers);
+	SetFlagsNoCarry(prevReg, 1, true, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->D;
 	uint8_t prevReg = reg;
 	reg--;
-	SetFlagsNoCarry(prevReg, 1, reg, true, registers);
+	SetFlagsNoCarry(prevReg, 1, true, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->H;
 	uint8_t prevReg = reg;
 	reg--;
-	SetFlagsNoCarry(prevReg, 1, reg, true, registers);
+	SetFlagsNoCarry(prevReg, 1, true, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {	 
 	if (data.m_cycles == 0)
 	{
@@ -1814,54 +1802,54 @@ InstructionResult InstructionFunctions::DEC_mHL(const char* mnemonic, Instructio
 	{
 		uint8_t reg = data.m_tmp_u8 - 1;
 		memory.Write(registers->HL, reg);
-		SetFlagsNoCarry(data.m_tmp_u8, 1, reg, true, registers);
+		SetFlagsNoCarry(data.m_tmp_u8, 1, true, registers);
 		return InstructionResult::Continue;
 	}
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->C;
 	uint8_t prevReg = reg;
 	reg--;
-	SetFlagsNoCarry(prevReg, 1, reg, true, registers);
+	SetFlagsNoCarry(prevReg, 1, true, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->E;
 	uint8_t prevReg = reg;
 	reg--;
-	SetFlagsNoCarry(prevReg, 1, reg, true, registers);
+	SetFlagsNoCarry(prevReg, 1, true, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->L;
 	uint8_t prevReg = reg;
 	reg--;
-	SetFlagsNoCarry(prevReg, 1, reg, true, registers);
+	SetFlagsNoCarry(prevReg, 1, true, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	uint8_t& reg = registers->A;
 	uint8_t prevReg = reg;
 	reg--;
-	SetFlagsNoCarry(prevReg, 1, reg, true, registers);
+	SetFlagsNoCarry(prevReg, 1, true, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CPL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CPL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	registers->A = ~registers->A;
 	registers->SetFlag(Registers::Flags::n);
@@ -1870,49 +1858,49 @@ InstructionResult InstructionFunctions::CPL(const char* mnemonic, InstructionTem
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Addition(registers->A, registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Addition(registers->A, registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Addition(registers->A, registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Addition(registers->A, registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Addition(registers->A, registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Addition(registers->A, registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
  	if (data.m_cycles == 0)
 	{
@@ -1925,56 +1913,56 @@ InstructionResult InstructionFunctions::ADD_A_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Addition(registers->A, registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	AdditionWithCarry(registers->A, registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	AdditionWithCarry(registers->A, registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	AdditionWithCarry(registers->A, registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	AdditionWithCarry(registers->A, registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	AdditionWithCarry(registers->A, registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	AdditionWithCarry(registers->A, registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -1987,56 +1975,56 @@ InstructionResult InstructionFunctions::ADC_A_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	AdditionWithCarry(registers->A, registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Subtraction(registers->A, registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Subtraction(registers->A, registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Subtraction(registers->A, registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Subtraction(registers->A, registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Subtraction(registers->A, registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Subtraction(registers->A, registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2049,56 +2037,56 @@ InstructionResult InstructionFunctions::SUB_A_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	Subtraction(registers->A, registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SubtractionWithCarry(registers->A, registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SubtractionWithCarry(registers->A, registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SubtractionWithCarry(registers->A, registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SubtractionWithCarry(registers->A, registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SubtractionWithCarry(registers->A, registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SubtractionWithCarry(registers->A, registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2111,56 +2099,56 @@ InstructionResult InstructionFunctions::SBC_A_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SubtractionWithCarry(registers->A, registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseAnd(registers->A, registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseAnd(registers->A, registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseAnd(registers->A, registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseAnd(registers->A, registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseAnd(registers->A, registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseAnd(registers->A, registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2173,56 +2161,56 @@ InstructionResult InstructionFunctions::AND_A_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseAnd(registers->A, registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseXor(registers->A, registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseXor(registers->A, registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseXor(registers->A, registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseXor(registers->A, registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseXor(registers->A, registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseXor(registers->A, registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2235,56 +2223,56 @@ InstructionResult InstructionFunctions::XOR_A_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseXor(registers->A, registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseOr(registers->A, registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseOr(registers->A, registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseOr(registers->A, registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseOr(registers->A, registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseOr(registers->A, registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseOr(registers->A, registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2297,56 +2285,56 @@ InstructionResult InstructionFunctions::OR_A_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	BitwiseOr(registers->A, registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	CompareSubtraction(registers->A, registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	CompareSubtraction(registers->A, registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	CompareSubtraction(registers->A, registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	CompareSubtraction(registers->A, registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	CompareSubtraction(registers->A, registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	CompareSubtraction(registers->A, registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2359,14 +2347,14 @@ InstructionResult InstructionFunctions::CP_A_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	CompareSubtraction(registers->A, registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2379,7 +2367,7 @@ InstructionResult InstructionFunctions::ADD_A_n(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SUB_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SUB_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2392,7 +2380,7 @@ InstructionResult InstructionFunctions::SUB_A_n(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::AND_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::AND_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2405,7 +2393,7 @@ InstructionResult InstructionFunctions::AND_A_n(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::OR_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::OR_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2418,7 +2406,7 @@ InstructionResult InstructionFunctions::OR_A_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADC_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADC_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2431,7 +2419,7 @@ InstructionResult InstructionFunctions::ADC_A_n(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SBC_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SBC_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2444,7 +2432,7 @@ InstructionResult InstructionFunctions::SBC_A_n(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::XOR_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::XOR_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2457,7 +2445,7 @@ InstructionResult InstructionFunctions::XOR_A_n(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::CP_A_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::CP_A_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2470,7 +2458,7 @@ InstructionResult InstructionFunctions::CP_A_n(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DAA(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DAA(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	bool subtraction = registers->GetFlag(Registers::Flags::n);
 	bool halfCarry = registers->GetFlag(Registers::Flags::h);
@@ -2495,7 +2483,7 @@ InstructionResult InstructionFunctions::DAA(const char* mnemonic, InstructionTem
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLCA(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLCA(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeft(registers->A, registers);
 	registers->SetFlag(Registers::Flags::zf, 0);
@@ -2503,7 +2491,7 @@ InstructionResult InstructionFunctions::RLCA(const char* mnemonic, InstructionTe
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLA(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLA(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeftWithCarry(registers->A, registers);
 	registers->SetFlag(Registers::Flags::zf, 0);
@@ -2511,7 +2499,7 @@ InstructionResult InstructionFunctions::RLA(const char* mnemonic, InstructionTem
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRCA(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRCA(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRight(registers->A, registers);
 	registers->SetFlag(Registers::Flags::zf, 0);
@@ -2519,7 +2507,7 @@ InstructionResult InstructionFunctions::RRCA(const char* mnemonic, InstructionTe
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRA(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRA(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRightWithCarry(registers->A, registers);
 	registers->SetFlag(Registers::Flags::zf, 0);
@@ -2527,49 +2515,49 @@ InstructionResult InstructionFunctions::RRA(const char* mnemonic, InstructionTem
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLC_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLC_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeft(registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLC_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLC_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeft(registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLC_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLC_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeft(registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLC_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLC_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeft(registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLC_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLC_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeft(registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLC_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLC_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeft(registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLC_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLC_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
  	if (data.m_cycles == 0)
 	{
@@ -2586,56 +2574,56 @@ InstructionResult InstructionFunctions::RLC_mHL(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RLC_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RLC_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeft(registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRC_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRC_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRight(registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRC_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRC_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRight(registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRC_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRC_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRight(registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRC_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRC_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRight(registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRC_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRC_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRight(registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRC_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRC_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRight(registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRC_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRC_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2652,56 +2640,56 @@ InstructionResult InstructionFunctions::RRC_mHL(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RRC_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RRC_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRight(registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RL_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RL_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeftWithCarry(registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RL_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RL_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeftWithCarry(registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RL_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RL_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeftWithCarry(registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RL_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RL_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeftWithCarry(registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RL_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RL_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeftWithCarry(registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RL_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RL_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeftWithCarry(registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RL_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RL_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2718,56 +2706,56 @@ InstructionResult InstructionFunctions::RL_mHL(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RL_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RL_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateLeftWithCarry(registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RR_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RR_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRightWithCarry(registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RR_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RR_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRightWithCarry(registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RR_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RR_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRightWithCarry(registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RR_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RR_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRightWithCarry(registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RR_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RR_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRightWithCarry(registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RR_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RR_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRightWithCarry(registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RR_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RR_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2784,56 +2772,56 @@ InstructionResult InstructionFunctions::RR_mHL(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RR_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RR_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	RotateRightWithCarry(registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SLA_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SLA_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftLeftArithmetic(registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SLA_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SLA_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftLeftArithmetic(registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SLA_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SLA_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftLeftArithmetic(registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SLA_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SLA_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftLeftArithmetic(registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SLA_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SLA_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftLeftArithmetic(registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SLA_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SLA_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftLeftArithmetic(registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SLA_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SLA_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2850,56 +2838,56 @@ InstructionResult InstructionFunctions::SLA_mHL(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SLA_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SLA_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftLeftArithmetic(registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRA_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRA_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightArithmetic(registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRA_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRA_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightArithmetic(registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRA_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRA_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightArithmetic(registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRA_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRA_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightArithmetic(registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRA_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRA_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightArithmetic(registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRA_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRA_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightArithmetic(registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRA_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRA_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2916,56 +2904,56 @@ InstructionResult InstructionFunctions::SRA_mHL(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRA_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRA_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightArithmetic(registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SWAP_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SWAP_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SwapNibbles(registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SWAP_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SWAP_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SwapNibbles(registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SWAP_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SWAP_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SwapNibbles(registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SWAP_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SWAP_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SwapNibbles(registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SWAP_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SWAP_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SwapNibbles(registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SWAP_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SWAP_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SwapNibbles(registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SWAP_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SWAP_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -2982,56 +2970,56 @@ InstructionResult InstructionFunctions::SWAP_mHL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SWAP_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SWAP_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SwapNibbles(registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRL_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRL_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightLogic(registers->B, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRL_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRL_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightLogic(registers->C, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRL_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRL_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightLogic(registers->D, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRL_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRL_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightLogic(registers->E, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRL_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRL_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightLogic(registers->H, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRL_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRL_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightLogic(registers->L, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRL_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRL_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3048,56 +3036,56 @@ InstructionResult InstructionFunctions::SRL_mHL(const char* mnemonic, Instructio
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SRL_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SRL_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ShiftRightLogic(registers->A, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_0_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_0_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->B, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_0_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_0_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->C, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_0_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_0_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->D, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_0_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_0_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->E, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_0_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_0_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->H, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_0_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_0_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->L, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_0_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_0_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3109,56 +3097,56 @@ InstructionResult InstructionFunctions::BIT_0_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_0_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_0_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->A, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_1_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_1_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->B, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_1_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_1_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->C, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_1_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_1_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->D, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_1_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_1_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->E, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_1_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_1_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->H, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_1_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_1_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->L, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_1_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_1_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3170,56 +3158,56 @@ InstructionResult InstructionFunctions::BIT_1_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_1_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_1_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->A, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_2_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_2_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->B, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_2_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_2_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->C, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_2_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_2_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->D, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_2_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_2_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->E, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_2_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_2_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->H, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_2_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_2_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->L, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_2_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_2_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3231,56 +3219,56 @@ InstructionResult InstructionFunctions::BIT_2_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_2_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_2_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->A, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_3_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_3_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->B, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_3_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_3_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->C, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_3_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_3_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->D, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_3_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_3_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->E, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_3_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_3_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->H, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_3_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_3_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->L, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_3_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_3_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3292,56 +3280,56 @@ InstructionResult InstructionFunctions::BIT_3_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_3_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_3_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->A, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_4_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_4_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->B, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_4_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_4_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->C, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_4_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_4_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->D, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_4_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_4_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->E, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_4_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_4_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->H, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_4_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_4_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->L, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_4_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_4_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3353,56 +3341,56 @@ InstructionResult InstructionFunctions::BIT_4_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_4_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_4_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->A, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_5_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_5_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->B, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_5_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_5_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->C, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_5_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_5_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->D, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_5_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_5_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->E, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_5_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_5_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->H, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_5_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_5_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->L, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_5_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_5_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3414,56 +3402,56 @@ InstructionResult InstructionFunctions::BIT_5_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_5_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_5_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->A, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_6_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_6_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->B, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_6_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_6_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->C, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_6_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_6_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->D, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_6_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_6_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->E, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_6_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_6_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->H, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_6_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_6_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->L, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_6_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_6_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3475,56 +3463,56 @@ InstructionResult InstructionFunctions::BIT_6_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_6_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_6_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->A, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_7_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_7_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->B, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_7_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_7_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->C, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_7_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_7_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->D, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_7_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_7_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->E, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_7_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_7_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->H, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_7_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_7_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->L, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_7_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_7_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3536,56 +3524,56 @@ InstructionResult InstructionFunctions::BIT_7_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::BIT_7_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::BIT_7_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	TestBit(registers->A, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_0_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_0_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->B, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_0_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_0_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->C, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_0_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_0_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->D, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_0_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_0_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->E, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_0_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_0_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->H, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_0_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_0_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->L, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_0_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_0_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3602,56 +3590,56 @@ InstructionResult InstructionFunctions::RES_0_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_0_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_0_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->A, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_1_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_1_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->B, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_1_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_1_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->C, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_1_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_1_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->D, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_1_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_1_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->E, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_1_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_1_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->H, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_1_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_1_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->L, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_1_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_1_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3668,56 +3656,56 @@ InstructionResult InstructionFunctions::RES_1_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_1_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_1_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->A, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_2_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_2_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->B, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_2_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_2_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->C, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_2_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_2_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->D, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_2_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_2_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->E, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_2_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_2_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->H, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_2_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_2_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->L, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_2_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_2_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3734,56 +3722,56 @@ InstructionResult InstructionFunctions::RES_2_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_2_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_2_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->A, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_3_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_3_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->B, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_3_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_3_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->C, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_3_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_3_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->D, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_3_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_3_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->E, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_3_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_3_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->H, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_3_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_3_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->L, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_3_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_3_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3800,56 +3788,56 @@ InstructionResult InstructionFunctions::RES_3_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_3_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_3_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->A, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_4_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_4_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->B, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_4_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_4_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->C, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_4_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_4_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->D, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_4_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_4_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->E, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_4_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_4_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->H, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_4_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_4_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->L, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_4_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_4_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3866,56 +3854,56 @@ InstructionResult InstructionFunctions::RES_4_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_4_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_4_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->A, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_5_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_5_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->B, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_5_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_5_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->C, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_5_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_5_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->D, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_5_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_5_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->E, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_5_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_5_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->H, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_5_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_5_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->L, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_5_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_5_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3932,56 +3920,56 @@ InstructionResult InstructionFunctions::RES_5_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_5_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_5_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->A, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_6_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_6_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->B, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_6_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_6_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->C, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_6_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_6_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->D, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_6_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_6_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->E, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_6_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_6_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->H, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_6_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_6_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->L, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_6_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_6_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -3998,56 +3986,56 @@ InstructionResult InstructionFunctions::RES_6_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_6_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_6_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->A, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_7_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_7_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->B, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_7_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_7_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->C, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_7_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_7_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->D, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_7_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_7_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->E, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_7_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_7_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->H, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_7_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_7_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->L, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_7_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_7_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4064,56 +4052,56 @@ InstructionResult InstructionFunctions::RES_7_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::RES_7_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::RES_7_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	ResetBit(registers->A, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_0_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_0_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->B, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_0_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_0_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->C, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_0_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_0_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->D, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_0_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_0_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->E, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_0_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_0_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->H, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_0_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_0_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->L, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_0_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_0_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4130,56 +4118,56 @@ InstructionResult InstructionFunctions::SET_0_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_0_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_0_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->A, 0, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_1_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_1_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->B, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_1_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_1_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->C, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_1_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_1_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->D, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_1_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_1_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->E, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_1_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_1_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->H, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_1_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_1_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->L, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_1_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_1_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4196,56 +4184,56 @@ InstructionResult InstructionFunctions::SET_1_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_1_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_1_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->A, 1, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_2_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_2_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->B, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_2_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_2_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->C, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_2_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_2_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->D, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_2_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_2_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->E, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_2_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_2_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->H, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_2_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_2_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->L, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_2_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_2_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4262,56 +4250,56 @@ InstructionResult InstructionFunctions::SET_2_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_2_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_2_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->A, 2, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_3_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_3_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->B, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_3_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_3_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->C, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_3_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_3_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->D, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_3_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_3_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->E, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_3_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_3_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->H, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_3_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_3_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->L, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_3_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_3_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4328,56 +4316,56 @@ InstructionResult InstructionFunctions::SET_3_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_3_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_3_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->A, 3, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_4_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_4_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->B, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_4_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_4_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->C, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_4_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_4_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->D, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_4_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_4_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->E, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_4_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_4_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->H, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_4_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_4_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->L, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_4_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_4_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4394,56 +4382,56 @@ InstructionResult InstructionFunctions::SET_4_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_4_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_4_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->A, 4, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_5_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_5_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->B, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_5_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_5_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->C, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_5_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_5_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->D, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_5_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_5_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->E, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_5_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_5_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->H, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_5_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_5_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->L, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_5_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_5_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4460,56 +4448,56 @@ InstructionResult InstructionFunctions::SET_5_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_5_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_5_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->A, 5, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_6_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_6_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->B, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_6_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_6_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->C, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_6_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_6_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->D, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_6_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_6_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->E, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_6_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_6_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->H, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_6_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_6_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->L, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_6_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_6_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4526,56 +4514,56 @@ InstructionResult InstructionFunctions::SET_6_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_6_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_6_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->A, 6, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_7_B(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_7_B(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->B, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_7_C(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_7_C(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->C, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_7_D(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_7_D(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->D, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_7_E(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_7_E(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->E, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_7_H(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_7_H(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->H, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_7_L(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_7_L(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->L, 7, registers);
 	
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_7_mHL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_7_mHL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4592,7 +4580,7 @@ InstructionResult InstructionFunctions::SET_7_mHL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::SET_7_A(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::SET_7_A(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	SetBit(registers->A, 7, registers);
 	
@@ -4602,7 +4590,7 @@ InstructionResult InstructionFunctions::SET_7_A(const char* mnemonic, Instructio
 //16 bit loads 
 //-------------------------------------------------------------------------------------------------
 
-InstructionResult InstructionFunctions::LD_BC_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_BC_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4621,7 +4609,7 @@ InstructionResult InstructionFunctions::LD_BC_nn(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_DE_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_DE_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4640,7 +4628,7 @@ InstructionResult InstructionFunctions::LD_DE_nn(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_HL_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_HL_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4659,7 +4647,7 @@ InstructionResult InstructionFunctions::LD_HL_nn(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_SP_nn(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_SP_nn(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4678,7 +4666,7 @@ InstructionResult InstructionFunctions::LD_SP_nn(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_mnn_SP(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_mnn_SP(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	switch (data.m_cycles)
 	{
@@ -4702,7 +4690,7 @@ InstructionResult InstructionFunctions::LD_mnn_SP(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_HL_SP_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_HL_SP_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4722,7 +4710,7 @@ InstructionResult InstructionFunctions::LD_HL_SP_n(const char* mnemonic, Instruc
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::LD_SP_HL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::LD_SP_HL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
  	if (data.m_cycles == 0)
 	{
@@ -4733,7 +4721,7 @@ InstructionResult InstructionFunctions::LD_SP_HL(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::POP_BC(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::POP_BC(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4752,7 +4740,7 @@ InstructionResult InstructionFunctions::POP_BC(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::POP_DE(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::POP_DE(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4771,7 +4759,7 @@ InstructionResult InstructionFunctions::POP_DE(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::POP_HL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::POP_HL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4790,7 +4778,7 @@ InstructionResult InstructionFunctions::POP_HL(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::POP_AF(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::POP_AF(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4806,29 +4794,30 @@ InstructionResult InstructionFunctions::POP_AF(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::PUSH_BC(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::PUSH_BC(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Push(registers->BC, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::PUSH_DE(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::PUSH_DE(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Push(registers->DE, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::PUSH_HL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::PUSH_HL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	return Push(registers->HL, data.m_cycles, registers, memory);
 }
 
-InstructionResult InstructionFunctions::PUSH_AF(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::PUSH_AF(InstructionTempData& data, Registers* registers, Memory& memory)
 {
+	registers->ResolveFlags();
 	return Push(registers->AF, data.m_cycles, registers, memory);
 }
 
 //16 bit arithmatic/logic 
 //-------------------------------------------------------------------------------------------------
-InstructionResult InstructionFunctions::INC_BC(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_BC(InstructionTempData& data, Registers* registers, Memory& memory)
 {
  	if (data.m_cycles == 0)
 	{
@@ -4839,7 +4828,7 @@ InstructionResult InstructionFunctions::INC_BC(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_DE(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_DE(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4850,7 +4839,7 @@ InstructionResult InstructionFunctions::INC_DE(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_HL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_HL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4861,7 +4850,7 @@ InstructionResult InstructionFunctions::INC_HL(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INC_SP(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INC_SP(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4872,7 +4861,7 @@ InstructionResult InstructionFunctions::INC_SP(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_HL_BC(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_HL_BC(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4885,7 +4874,7 @@ InstructionResult InstructionFunctions::ADD_HL_BC(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_HL_DE(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_HL_DE(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4898,7 +4887,7 @@ InstructionResult InstructionFunctions::ADD_HL_DE(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_HL_HL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_HL_HL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4911,7 +4900,7 @@ InstructionResult InstructionFunctions::ADD_HL_HL(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_HL_SP(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_HL_SP(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4924,7 +4913,7 @@ InstructionResult InstructionFunctions::ADD_HL_SP(const char* mnemonic, Instruct
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::ADD_SP_n(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::ADD_SP_n(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4945,7 +4934,7 @@ InstructionResult InstructionFunctions::ADD_SP_n(const char* mnemonic, Instructi
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_BC(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_BC(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4957,7 +4946,7 @@ InstructionResult InstructionFunctions::DEC_BC(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_DE(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_DE(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4969,7 +4958,7 @@ InstructionResult InstructionFunctions::DEC_DE(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_HL(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_HL(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4981,7 +4970,7 @@ InstructionResult InstructionFunctions::DEC_HL(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::DEC_SP(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::DEC_SP(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	if (data.m_cycles == 0)
 	{
@@ -4993,7 +4982,7 @@ InstructionResult InstructionFunctions::DEC_SP(const char* mnemonic, Instruction
 	return InstructionResult::Finished;
 }
 
-InstructionResult InstructionFunctions::INTERRUPT_HANDLING(const char* mnemonic, InstructionTempData& data, Registers* registers, Memory& memory)
+InstructionResult InstructionFunctions::INTERRUPT_HANDLING(InstructionTempData& data, Registers* registers, Memory& memory)
 {
 	switch (data.m_cycles)
 	{
@@ -5017,3 +5006,20 @@ InstructionResult InstructionFunctions::INTERRUPT_HANDLING(const char* mnemonic,
 		return InstructionResult::Finished;
 	}
 }
+
+#if CPU_SWITCH_DISPATCH
+#define INSTRUCTION_DISPATCH_CASE(opcode, mnemonic, length, duration, func) case opcode: return InstructionFunctions::func(data, registers, memory);
+
+InstructionResult InstructionFunctions::Execute(uint16_t opcode, InstructionTempData& data, Registers* registers, Memory& memory)
+{
+	// The handlers live in this translation unit, so the compiler can turn this into a jump table of inlined handlers
+	switch (opcode)
+	{
+	INSTRUCTION_TABLE(INSTRUCTION_DISPATCH_CASE)
+	default:
+		return InstructionFunctions::UNIMPLEMENTED(data, registers, memory);
+	}
+}
+
+#undef INSTRUCTION_DISPATCH_CASE
+#endif
@@ -0,0 +1,519 @@
+#pragma once
+
+// Opcode table of the CPU, X(index, mnemonic, length, duration, handler) per entry.
+// Indices 0x100-0x1FF are the CB extension instructions, followed by the interrupt handler and the pseudo NOP used when waking up from HALT.
+#define INSTRUCTION_TABLE(X) \
+	X(0x000, "NOP", 1, 1, NOP) \
+	X(0x001, "LD BC nn", 3, 3, LD_BC_nn) \
+	X(0x002, "LD (BC) A", 1, 2, LD_mBC_A) \
+	X(0x003, "INC BC", 1, 2, INC_BC) \
+	X(0x004, "INC B", 1, 1, INC_B) \
+	X(0x005, "DEC B", 1, 1, DEC_B) \
+	X(0x006, "LD B n", 2, 2, LD_B_n) \
+	X(0x007, "RLCA", 1, 1, RLCA) \
+	X(0x008, "LD (nn) SP", 3, 5, LD_mnn_SP) \
+	X(0x009, "ADD HL BC", 1, 2, ADD_HL_BC) \
+	X(0x00A, "LD A (BC)", 1, 2, LD_A_mBC) \
+	X(0x00B, "DEC BC", 1, 2, DEC_BC) \
+	X(0x00C, "INC C", 1, 1, INC_C) \
+	X(0x00D, "DEC C", 1, 1, DEC_C) \
+	X(0x00E, "LD C n", 2, 2, LD_C_n) \
+	X(0x00F, "RRCA", 1, 1, RRCA) \
+	X(0x010, "STOP", 1, 2, STOP) \
+	X(0x011, "LD DE nn", 3, 3, LD_DE_nn) \
+	X(0x012, "LD (DE) A", 1, 2, LD_mDE_A) \
+	X(0x013, "INC DE", 1, 2, INC_DE) \
+	X(0x014, "INC D", 1, 1, INC_D) \
+	X(0x015, "DEC D", 1, 1, DEC_D) \
+	X(0x016, "LD D n", 2, 2, LD_D_n) \
+	X(0x017, "RLA", 1, 1, RLA) \
+	X(0x018, "JR n", 2, 3, JR_n) \
+	X(0x019, "ADD HL DE", 1, 2, ADD_HL_DE) \
+	X(0x01A, "LD A (DE)", 1, 2, LD_A_mDE) \
+	X(0x01B, "DEC DE", 1, 2, DEC_DE) \
+	X(0x01C, "INC E", 1, 1, INC_E) \
+	X(0x01D, "DEC E", 1, 1, DEC_E) \
+	X(0x01E, "LD E n", 2, 2, LD_E_n) \
+	X(0x01F, "RRA", 1, 1, RRA) \
+	X(0x020, "JR NZ n", 2, 2, JR_NZ_n) \
+	X(0x021, "LD HL nn", 3, 3, LD_HL_nn) \
+	X(0x022, "LD (HL+) A", 1, 2, LD_mHLinc_A) \
+	X(0x023, "INC HL", 1, 2, INC_HL) \
+	X(0x024, "INC H", 1, 1, INC_H) \
+	X(0x025, "DEC H", 1, 1, DEC_H) \
+	X(0x026, "LD H n", 2, 2, LD_H_n) \
+	X(0x027, "DAA", 1, 1, DAA) \
+	X(0x028, "JR Z n", 2, 2, JR_Z_n) \
+	X(0x029, "ADD HL HL", 1, 2, ADD_HL_HL) \
+	X(0x02A, "LD A (HL+)", 1, 2, LD_A_mHLinc) \
+	X(0x02B, "DEC HL", 1, 2, DEC_HL) \
+	X(0x02C, "INC L", 1, 1, INC_L) \
+	X(0x02D, "DEC L", 1, 1, DEC_L) \
+	X(0x02E, "LD L n", 2, 2, LD_L_n) \
+	X(0x02F, "CPL", 1, 1, CPL) \
+	X(0x030, "JR NC n", 2, 2, JR_NC_n) \
+	X(0x031, "LD SP nn", 3, 3, LD_SP_nn) \
+	X(0x032, "LD (HL-) A", 1, 2, LD_mHLdec_A) \
+	X(0x033, "INC SP", 1, 2, INC_SP) \
+	X(0x034, "INC (HL)", 1, 3, INC_mHL) \
+	X(0x035, "DEC (HL)", 1, 3, DEC_mHL) \
+	X(0x036, "LD (HL) n", 2, 3, LD_mHL_n) \
+	X(0x037, "SCF", 1, 1, SCF) \
+	X(0x038, "JR C n", 2, 2, JR_C_n) \
+	X(0x039, "ADD HL SP", 1, 2, ADD_HL_SP) \
+	X(0x03A, "LD A (HL-)", 1, 2, LD_A_mHLdec) \
+	X(0x03B, "DEC SP", 1, 2, DEC_SP) \
+	X(0x03C, "INC A", 1, 1, INC_A) \
+	X(0x03D, "DEC_A", 1, 1, DEC_A) \
+	X(0x03E, "LD A n", 2, 2, LD_A_n) \
+	X(0x03F, "CCF", 1, 1, CCF) \
+	X(0x040, "LD B B", 1, 1, LD_B_B) \
+	X(0x041, "LD B C", 1, 1, LD_B_C) \
+	X(0x042, "LD B D", 1, 1, LD_B_D) \
+	X(0x043, "LD B E", 1, 1, LD_B_E) \
+	X(0x044, "LD B H", 1, 1, LD_B_H) \
+	X(0x045, "LD B L", 1, 1, LD_B_L) \
+	X(0x046, "LD B (HL)", 1, 2, LD_B_mHL) \
+	X(0x047, "LD B A", 1, 1, LD_B_A) \
+	X(0x048, "LD C B", 1, 1, LD_C_B) \
+	X(0x049, "LD C C", 1, 1, LD_C_C) \
+	X(0x04A, "LD C D", 1, 1, LD_C_D) \
+	X(0x04B, "LD C E", 1, 1, LD_C_E) \
+	X(0x04C, "LD C H", 1, 1, LD_C_H) \
+	X(0x04D, "LD C L", 1, 1, LD_C_L) \
+	X(0x04E, "LD C (HL)", 1, 2, LD_C_mHL) \
+	X(0x04F, "LD C A", 1, 1, LD_C_A) \
+	X(0x050, "LD D B", 1, 1, LD_D_B) \
+	X(0x051, "LD D C", 1, 1, LD_D_C) \
+	X(0x052, "LD D D", 1, 1, LD_D_D) \
+	X(0x053, "LD D E", 1, 1, LD_D_E) \
+	X(0x054, "LD D H", 1, 1, LD_D_H) \
+	X(0x055, "LD D L", 1, 1, LD_D_L) \
+	X(0x056, "LD D (HL)", 1, 2, LD_D_mHL) \
+	X(0x057, "LD D A", 1, 1, LD_D_A) \
+	X(0x058, "LD E B", 1, 1, LD_E_B) \
+	X(0x059, "LD E C", 1, 1, LD_E_C) \
+	X(0x05A, "LD E D", 1, 1, LD_E_D) \
+	X(0x05B, "LD E E", 1, 1, LD_E_E) \
+	X(0x05C, "LD E H", 1, 1, LD_E_H) \
+	X(0x05D, "LD E L", 1, 1, LD_E_L) \
+	X(0x05E, "LD E (HL)", 1, 2, LD_E_mHL) \
+	X(0x05F, "LD E A", 1, 1, LD_E_A) \
+	X(0x060, "LD H B", 1, 1, LD_H_B) \
+	X(0x061, "LD H C", 1, 1, LD_H_C) \
+	X(0x062, "LD H D", 1, 1, LD_H_D) \
+	X(0x063, "LD H E", 1, 1, LD_H_E) \
+	X(0x064, "LD H H", 1, 1, LD_H_H) \
+	X(0x065, "LD H L", 1, 1, LD_H_L) \
+	X(0x066, "LD H (HL)", 1, 2, LD_H_mHL) \
+	X(0x067, "LD H A", 1, 1, LD_H_A) \
+	X(0x068, "LD L B", 1, 1, LD_L_B) \
+	X(0x069, "LD L C", 1, 1, LD_L_C) \
+	X(0x06A, "LD L D", 1, 1, LD_L_D) \
+	X(0x06B, "LD L E", 1, 1, LD_L_E) \
+	X(0x06C, "LD L H", 1, 1, LD_L_H) \
+	X(0x06D, "LD L L", 1, 1, LD_L_L) \
+	X(0x06E, "LD L (HL)", 1, 2, LD_L_mHL) \
+	X(0x06F, "LD L A", 1, 1, LD_L_A) \
+	X(0x070, "LD (HL) B", 1, 2, LD_mHL_B) \
+	X(0x071, "LD (HL) C", 1, 2, LD_mHL_C) \
+	X(0x072, "LD (HL) D", 1, 2, LD_mHL_D) \
+	X(0x073, "LD (HL) E", 1, 2, LD_mHL_E) \
+	X(0x074, "LD (HL) H", 1, 2, LD_mHL_H) \
+	X(0x075, "LD (HL) L", 1, 2, LD_mHL_L) \
+	X(0x076, "HALT", 1, 1, HALT) \
+	X(0x077, "LD (HL) A", 1, 2, LD_mHL_A) \
+	X(0x078, "LD A B", 1, 1, LD_A_B) \
+	X(0x079, "LD A C", 1, 1, LD_A_C) \
+	X(0x07A, "LD A D", 1, 1, LD_A_D) \
+	X(0x07B, "LD A E", 1, 1, LD_A_E) \
+	X(0x07C, "LD A H", 1, 1, LD_A_H) \
+	X(0x07D, "LD A L", 1, 1, LD_A_L) \
+	X(0x07E, "LD A (HL)", 1, 2, LD_A_mHL) \
+	X(0x07F, "LD A A", 1, 1, LD_A_A) \
+	X(0x080, "ADD A B", 1, 1, ADD_A_B) \
+	X(0x081, "ADD A C", 1, 1, ADD_A_C) \
+	X(0x082, "ADD A D", 1, 1, ADD_A_D) \
+	X(0x083, "ADD A E", 1, 1, ADD_A_E) \
+	X(0x084, "ADD A H", 1, 1, ADD_A_H) \
+	X(0x085, "ADD A L", 1, 1, ADD_A_L) \
+	X(0x086, "ADD A (HL)", 1, 2, ADD_A_mHL) \
+	X(0x087, "ADD A A", 1, 1, ADD_A_A) \
+	X(0x088, "ADC A B", 1, 1, ADC_A_B) \
+	X(0x089, "ADC A C", 1, 1, ADC_A_C) \
+	X(0x08A, "ADC A D", 1, 1, ADC_A_D) \
+	X(0x08B, "ADC A E", 1, 1, ADC_A_E) \
+	X(0x08C, "ADC A H", 1, 1, ADC_A_H) \
+	X(0x08D, "ADC A L", 1, 1, ADC_A_L) \
+	X(0x08E, "ADC A (HL)", 1, 2, ADC_A_mHL) \
+	X(0x08F, "ADC A A", 1, 1, ADC_A_A) \
+	X(0x090, "SUB A B", 1, 1, SUB_A_B) \
+	X(0x091, "SUB A C", 1, 1, SUB_A_C) \
+	X(0x092, "SUB A D", 1, 1, SUB_A_D) \
+	X(0x093, "SUB A E", 1, 1, SUB_A_E) \
+	X(0x094, "SUB A H", 1, 1, SUB_A_H) \
+	X(0x095, "SUB A L", 1, 1, SUB_A_L) \
+	X(0x096, "SUB A (HL)", 1, 2, SUB_A_mHL) \
+	X(0x097, "SUB A A", 1, 1, SUB_A_A) \
+	X(0x098, "SBC A B", 1, 1, SBC_A_B) \
+	X(0x099, "SBC A C", 1, 1, SBC_A_C) \
+	X(0x09A, "SBC A D", 1, 1, SBC_A_D) \
+	X(0x09B, "SBC A E", 1, 1, SBC_A_E) \
+	X(0x09C, "SBC A H", 1, 1, SBC_A_H) \
+	X(0x09D, "SBC A L", 1, 1, SBC_A_L) \
+	X(0x09E, "SBC A (HL)", 1, 2, SBC_A_mHL) \
+	X(0x09F, "SBC A A", 1, 1, SBC_A_A) \
+	X(0x0A0, "AND A B", 1, 1, AND_A_B) \
+	X(0x0A1, "AND A C", 1, 1, AND_A_C) \
+	X(0x0A2, "AND A D", 1, 1, AND_A_D) \
+	X(0x0A3, "AND A E", 1, 1, AND_A_E) \
+	X(0x0A4, "AND A H", 1, 1, AND_A_H) \
+	X(0x0A5, "AND A L", 1, 1, AND_A_L) \
+	X(0x0A6, "AND A (HL)", 1, 2, AND_A_mHL) \
+	X(0x0A7, "AND A A", 1, 1, AND_A_A) \
+	X(0x0A8, "XOR A B", 1, 1, XOR_A_B) \
+	X(0x0A9, "XOR A C", 1, 1, XOR_A_C) \
+	X(0x0AA, "XOR A D", 1, 1, XOR_A_D) \
+	X(0x0AB, "XOR A E", 1, 1, XOR_A_E) \
+	X(0x0AC, "XOR A H", 1, 1, XOR_A_H) \
+	X(0x0AD, "XOR A L", 1, 1, XOR_A_L) \
+	X(0x0AE, "XOR A (HL)", 1, 2, XOR_A_mHL) \
+	X(0x0AF, "XOR A A", 1, 1, XOR_A_A) \
+	X(0x0B0, "OR A B", 1, 1, OR_A_B) \
+	X(0x0B1, "OR A C", 1, 1, OR_A_C) \
+	X(0x0B2, "OR A D", 1, 1, OR_A_D) \
+	X(0x0B3, "OR A E", 1, 1, OR_A_E) \
+	X(0x0B4, "OR A H", 1, 1, OR_A_H) \
+	X(0x0B5, "OR A L", 1, 1, OR_A_L) \
+	X(0x0B6, "OR A (HL)", 1, 2, OR_A_mHL) \
+	X(0x0B7, "OR A A", 1, 1, OR_A_A) \
+	X(0x0B8, "CP A B", 1, 1, CP_A_B) \
+	X(0x0B9, "CP A C", 1, 1, CP_A_C) \
+	X(0x0BA, "CP A D", 1, 1, CP_A_D) \
+	X(0x0BB, "CP A E", 1, 1, CP_A_E) \
+	X(0x0BC, "CP A H", 1, 1, CP_A_H) \
+	X(0x0BD, "CP A L", 1, 1, CP_A_L) \
+	X(0x0BE, "CP A (HL)", 1, 2, CP_A_mHL) \
+	X(0x0BF, "CP A A", 1, 1, CP_A_A) \
+	X(0x0C0, "RET NZ", 1, 2, RET_NZ) \
+	X(0x0C1, "POP BC", 1, 3, POP_BC) \
+	X(0x0C2, "JP NZ nn", 3, 3, JP_NZ_nn) \
+	X(0x0C3, "JP nn", 3, 4, JP_nn) \
+	X(0x0C4, "CALL NZ nn", 3, 3, CALL_NZ_nn) \
+	X(0x0C5, "PUSH BC", 1, 4, PUSH_BC) \
+	X(0x0C6, "ADD A n", 2, 2, ADD_A_n) \
+	X(0x0C7, "RST 0x00", 1, 4, RST_00) \
+	X(0x0C8, "RET Z", 1, 2, RET_Z) \
+	X(0x0C9, "RET", 1, 4, RET) \
+	X(0x0CA, "JP Z nn", 3, 3, JP_Z_nn) \
+	X(0x0CB, "CB OP", 1, 1, UNIMPLEMENTED) \
+	X(0x0CC, "CALL Z nn", 3, 3, CALL_Z_nn) \
+	X(0x0CD, "CALL nn", 3, 6, CALL_nn) \
+	X(0x0CE, "ADC A n", 2, 2, ADC_A_n) \
+	X(0x0CF, "RST 0x08", 1, 4, RST_08) \
+	X(0x0D0, "RET NC", 1, 2, RET_NC) \
+	X(0x0D1, "POP DE", 1, 3, POP_DE) \
+	X(0x0D2, "JP NC nn", 3, 3, JP_NC_nn) \
+	X(0x0D3, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0D4, "CALL NC nn", 3, 3, CALL_NC_nn) \
+	X(0x0D5, "PUSH DE", 1, 4, PUSH_DE) \
+	X(0x0D6, "SUB A n", 2, 2, SUB_A_n) \
+	X(0x0D7, "RST 0x10", 1, 4, RST_10) \
+	X(0x0D8, "RET C", 1, 2, RET_C) \
+	X(0x0D9, "RETI", 1, 4, RETI) \
+	X(0x0DA, "JP C nn", 3, 3, JP_C_nn) \
+	X(0x0DB, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0DC, "CALL C nn", 3, 3, CALL_C_nn) \
+	X(0x0DD, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0DE, "SBC A n", 2, 2, SBC_A_n) \
+	X(0x0DF, "RST 0x18", 1, 4, RST_18) \
+	X(0x0E0, "LDH (n) A", 2, 3, LDH_mn_A) \
+	X(0x0E1, "POP HL", 1, 3, POP_HL) \
+	X(0x0E2, "LDH (C) A", 1, 2, LDH_mC_A) \
+	X(0x0E3, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0E4, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0E5, "PUSH HL", 1, 4, PUSH_HL) \
+	X(0x0E6, "AND A n", 2, 2, AND_A_n) \
+	X(0x0E7, "RST 0x20", 1, 4, RST_20) \
+	X(0x0E8, "ADD SP n", 2, 4, ADD_SP_n) \
+	X(0x0E9, "JP HL", 1, 1, JP_HL) \
+	X(0x0EA, "LD (nn) A", 3, 4, LD_mnn_A) \
+	X(0x0EB, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0EC, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0ED, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0EE, "XOR A n", 2, 2, XOR_A_n) \
+	X(0x0EF, "RST 0x28", 1, 4, RST_28) \
+	X(0x0F0, "LDH A (n)", 2, 3, LDH_A_mn) \
+	X(0x0F1, "POP AF", 1, 3, POP_AF) \
+	X(0x0F2, "LDH A (C)", 1, 2, LDH_A_mC) \
+	X(0x0F3, "DI", 1, 1, DI) \
+	X(0x0F4, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0F5, "PUSH AF", 1, 4, PUSH_AF) \
+	X(0x0F6, "OR A n", 2, 2, OR_A_n) \
+	X(0x0F7, "RST 0x30", 1, 4, RST_30) \
+	X(0x0F8, "LD HL SP+n", 2, 3, LD_HL_SP_n) \
+	X(0x0F9, "LD SP HL", 1, 2, LD_SP_HL) \
+	X(0x0FA, "LD A (nn)", 3, 4, LD_A_mnn) \
+	X(0x0FB, "EI", 1, 1, EI) \
+	X(0x0FC, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0FD, "UNASSIGNED", 1, 1, UNIMPLEMENTED) \
+	X(0x0FE, "CP A n", 2, 2, CP_A_n) \
+	X(0x0FF, "RST 0x38", 1, 4, RST_38) \
+	X(0x100, "RLC B", 2, 2, RLC_B) \
+	X(0x101, "RLC C", 2, 2, RLC_C) \
+	X(0x102, "RLC D", 2, 2, RLC_D) \
+	X(0x103, "RLC E", 2, 2, RLC_E) \
+	X(0x104, "RLC H", 2, 2, RLC_H) \
+	X(0x105, "RLC L", 2, 2, RLC_L) \
+	X(0x106, "RLC (HL)", 2, 4, RLC_mHL) \
+	X(0x107, "RLC A", 2, 2, RLC_A) \
+	X(0x108, "RRC B", 2, 2, RRC_B) \
+	X(0x109, "RRC C", 2, 2, RRC_C) \
+	X(0x10A, "RRC D", 2, 2, RRC_D) \
+	X(0x10B, "RRC E", 2, 2, RRC_E) \
+	X(0x10C, "RRC H", 2, 2, RRC_H) \
+	X(0x10D, "RRC L", 2, 2, RRC_L) \
+	X(0x10E, "RRC (HL)", 2, 4, RRC_mHL) \
+	X(0x10F, "RRC A", 2, 2, RRC_A) \
+	X(0x110, "RL B", 2, 2, RL_B) \
+	X(0x111, "RL C", 2, 2, RL_C) \
+	X(0x112, "RL D", 2, 2, RL_D) \
+	X(0x113, "RL E", 2, 2, RL_E) \
+	X(0x114, "RL H", 2, 2, RL_H) \
+	X(0x115, "RL L", 2, 2, RL_L) \
+	X(0x116, "RL (HL)", 2, 4, RL_mHL) \
+	X(0x117, "RL A", 2, 2, RL_A) \
+	X(0x118, "RR B", 2, 2, RR_B) \
+	X(0x119, "RR C", 2, 2, RR_C) \
+	X(0x11A, "RR D", 2, 2, RR_D) \
+	X(0x11B, "RR E", 2, 2, RR_E) \
+	X(0x11C, "RR H", 2, 2, RR_H) \
+	X(0x11D, "RR L", 2, 2, RR_L) \
+	X(0x11E, "RR (HL)", 2, 4, RR_mHL) \
+	X(0x11F, "RR A", 2, 2, RR_A) \
+	X(0x120, "SLA B", 2, 2, SLA_B) \
+	X(0x121, "SLA C", 2, 2, SLA_C) \
+	X(0x122, "SLA D", 2, 2, SLA_D) \
+	X(0x123, "SLA E", 2, 2, SLA_E) \
+	X(0x124, "SLA H", 2, 2, SLA_H) \
+	X(0x125, "SLA L", 2, 2, SLA_L) \
+	X(0x126, "SLA (HL)", 2, 4, SLA_mHL) \
+	X(0x127, "SLA A", 2, 2, SLA_A) \
+	X(0x128, "SRA B", 2, 2, SRA_B) \
+	X(0x129, "SRA C", 2, 2, SRA_C) \
+	X(0x12A, "SRA D", 2, 2, SRA_D) \
+	X(0x12B, "SRA E", 2, 2, SRA_E) \
+	X(0x12C, "SRA H", 2, 2, SRA_H) \
+	X(0x12D, "SRA L", 2, 2, SRA_L) \
+	X(0x12E, "SRA (HL)", 2, 4, SRA_mHL) \
+	X(0x12F, "SRA A", 2, 2, SRA_A) \
+	X(0x130, "SWAP B", 2, 2, SWAP_B) \
+	X(0x131, "SWAP C", 2, 2, SWAP_C) \
+	X(0x132, "SWAP D", 2, 2, SWAP_D) \
+	X(0x133, "SWAP E", 2, 2, SWAP_E) \
+	X(0x134, "SWAP H", 2, 2, SWAP_H) \
+	X(0x135, "SWAP L", 2, 2, SWAP_L) \
+	X(0x136, "SWAP (HL)", 2, 4, SWAP_mHL) \
+	X(0x137, "SWAP A", 2, 2, SWAP_A) \
+	X(0x138, "SRL B", 2, 2, SRL_B) \
+	X(0x139, "SRL C", 2, 2, SRL_C) \
+	X(0x13A, "SRL D", 2, 2, SRL_D) \
+	X(0x13B, "SRL E", 2, 2, SRL_E) \
+	X(0x13C, "SRL H", 2, 2, SRL_H) \
+	X(0x13D, "SRL L", 2, 2, SRL_L) \
+	X(0x13E, "SRL (HL)", 2, 4, SRL_mHL) \
+	X(0x13F, "SRL A", 2, 2, SRL_A) \
+	X(0x140, "BIT 0 B", 2, 2, BIT_0_B) \
+	X(0x141, "BIT 0 C", 2, 2, BIT_0_C) \
+	X(0x142, "BIT 0 D", 2, 2, BIT_0_D) \
+	X(0x143, "BIT 0 E", 2, 2, BIT_0_E) \
+	X(0x144, "BIT 0 H", 2, 2, BIT_0_H) \
+	X(0x145, "BIT 0 L", 2, 2, BIT_0_L) \
+	X(0x146, "BIT 0 (HL)", 2, 3, BIT_0_mHL) \
+	X(0x147, "BIT 0 A", 2, 2, BIT_0_A) \
+	X(0x148, "BIT 1 B", 2, 2, BIT_1_B) \
+	X(0x149, "BIT 1 C", 2, 2, BIT_1_C) \
+	X(0x14A, "BIT 1 D", 2, 2, BIT_1_D) \
+	X(0x14B, "BIT 1 E", 2, 2, BIT_1_E) \
+	X(0x14C, "BIT 1 H", 2, 2, BIT_1_H) \
+	X(0x14D, "BIT 1 L", 2, 2, BIT_1_L) \
+	X(0x14E, "BIT 1 (HL)", 2, 3, BIT_1_mHL) \
+	X(0x14F, "BIT 1 A", 2, 2, BIT_1_A) \
+	X(0x150, "BIT 2 B", 2, 2, BIT_2_B) \
+	X(0x151, "BIT 2 C", 2, 2, BIT_2_C) \
+	X(0x152, "BIT 2 D", 2, 2, BIT_2_D) \
+	X(0x153, "BIT 2 E", 2, 2, BIT_2_E) \
+	X(0x154, "BIT 2 H", 2, 2, BIT_2_H) \
+	X(0x155, "BIT 2 L", 2, 2, BIT_2_L) \
+	X(0x156, "BIT 2 (HL)", 2, 3, BIT_2_mHL) \
+	X(0x157, "BIT 2 A", 2, 2, BIT_2_A) \
+	X(0x158, "BIT 3 B", 2, 2, BIT_3_B) \
+	X(0x159, "BIT 3 C", 2, 2, BIT_3_C) \
+	X(0x15A, "BIT 3 D", 2, 2, BIT_3_D) \
+	X(0x15B, "BIT 3 E", 2, 2, BIT_3_E) \
+	X(0x15C, "BIT 3 H", 2, 2, BIT_3_H) \
+	X(0x15D, "BIT 3 L", 2, 2, BIT_3_L) \
+	X(0x15E, "BIT 3 (HL)", 2, 3, BIT_3_mHL) \
+	X(0x15F, "BIT 3 A", 2, 2, BIT_3_A) \
+	X(0x160, "BIT 4 B", 2, 2, BIT_4_B) \
+	X(0x161, "BIT 4 C", 2, 2, BIT_4_C) \
+	X(0x162, "BIT 4 D", 2, 2, BIT_4_D) \
+	X(0x163, "BIT 4 E", 2, 2, BIT_4_E) \
+	X(0x164, "BIT 4 H", 2, 2, BIT_4_H) \
+	X(0x165, "BIT 4 L", 2, 2, BIT_4_L) \
+	X(0x166, "BIT 4 (HL)", 2, 3, BIT_4_mHL) \
+	X(0x167, "BIT 4 A", 2, 2, BIT_4_A) \
+	X(0x168, "BIT 5 B", 2, 2, BIT_5_B) \
+	X(0x169, "BIT 5 C", 2, 2, BIT_5_C) \
+	X(0x16A, "BIT 5 D", 2, 2, BIT_5_D) \
+	X(0x16B, "BIT 5 E", 2, 2, BIT_5_E) \
+	X(0x16C, "BIT 5 H", 2, 2, BIT_5_H) \
+	X(0x16D, "BIT 5 L", 2, 2, BIT_5_L) \
+	X(0x16E, "BIT 5 (HL)", 2, 3, BIT_5_mHL) \
+	X(0x16F, "BIT 5 A", 2, 2, BIT_5_A) \
+	X(0x170, "BIT 6 B", 2, 2, BIT_6_B) \
+	X(0x171, "BIT 6 C", 2, 2, BIT_6_C) \
+	X(0x172, "BIT 6 D", 2, 2, BIT_6_D) \
+	X(0x173, "BIT 6 E", 2, 2, BIT_6_E) \
+	X(0x174, "BIT 6 H", 2, 2, BIT_6_H) \
+	X(0x175, "BIT 6 L", 2, 2, BIT_6_L) \
+	X(0x176, "BIT 6 (HL)", 2, 3, BIT_6_mHL) \
+	X(0x177, "BIT 6 A", 2, 2, BIT_6_A) \
+	X(0x178, "BIT 7 B", 2, 2, BIT_7_B) \
+	X(0x179, "BIT 7 C", 2, 2, BIT_7_C) \
+	X(0x17A, "BIT 7 D", 2, 2, BIT_7_D) \
+	X(0x17B, "BIT 7 E", 2, 2, BIT_7_E) \
+	X(0x17C, "BIT 7 H", 2, 2, BIT_7_H) \
+	X(0x17D, "BIT 7 L", 2, 2, BIT_7_L) \
+	X(0x17E, "BIT 7 (HL)", 2, 3, BIT_7_mHL) \
+	X(0x17F, "BIT 7 A", 2, 2, BIT_7_A) \
+	X(0x180, "RES 0 B", 2, 2, RES_0_B) \
+	X(0x181, "RES 0 C", 2, 2, RES_0_C) \
+	X(0x182, "RES 0 D", 2, 2, RES_0_D) \
+	X(0x183, "RES 0 E", 2, 2, RES_0_E) \
+	X(0x184, "RES 0 H", 2, 2, RES_0_H) \
+	X(0x185, "RES 0 L", 2, 2, RES_0_L) \
+	X(0x186, "RES 0 (HL)", 2, 4, RES_0_mHL) \
+	X(0x187, "RES 0 A", 2, 2, RES_0_A) \
+	X(0x188, "RES 1 B", 2, 2, RES_1_B) \
+	X(0x189, "RES 1 C", 2, 2, RES_1_C) \
+	X(0x18A, "RES 1 D", 2, 2, RES_1_D) \
+	X(0x18B, "RES 1 E", 2, 2, RES_1_E) \
+	X(0x18C, "RES 1 H", 2, 2, RES_1_H) \
+	X(0x18D, "RES 1 L", 2, 2, RES_1_L) \
+	X(0x18E, "RES 1 (HL)", 2, 4, RES_1_mHL) \
+	X(0x18F, "RES 1 A", 2, 2, RES_1_A) \
+	X(0x190, "RES 2 B", 2, 2, RES_2_B) \
+	X(0x191, "RES 2 C", 2, 2, RES_2_C) \
+	X(0x192, "RES 2 D", 2, 2, RES_2_D) \
+	X(0x193, "RES 2 E", 2, 2, RES_2_E) \
+	X(0x194, "RES 2 H", 2, 2, RES_2_H) \
+	X(0x195, "RES 2 L", 2, 2, RES_2_L) \
+	X(0x196, "RES 2 (HL)", 2, 4, RES_2_mHL) \
+	X(0x197, "RES 2 A", 2, 2, RES_2_A) \
+	X(0x198, "RES 3 B", 2, 2, RES_3_B) \
+	X(0x199, "RES 3 C", 2, 2, RES_3_C) \
+	X(0x19A, "RES 3 D", 2, 2, RES_3_D) \
+	X(0x19B, "RES 3 E", 2, 2, RES_3_E) \
+	X(0x19C, "RES 3 H", 2, 2, RES_3_H) \
+	X(0x19D, "RES 3 L", 2, 2, RES_3_L) \
+	X(0x19E, "RES 3 (HL)", 2, 4, RES_3_mHL) \
+	X(0x19F, "RES 3 A", 2, 2, RES_3_A) \
+	X(0x1A0, "RES 4 B", 2, 2, RES_4_B) \
+	X(0x1A1, "RES 4 C", 2, 2, RES_4_C) \
+	X(0x1A2, "RES 4 D", 2, 2, RES_4_D) \
+	X(0x1A3, "RES 4 E", 2, 2, RES_4_E) \
+	X(0x1A4, "RES 4 H", 2, 2, RES_4_H) \
+	X(0x1A5, "RES 4 L", 2, 2, RES_4_L) \
+	X(0x1A6, "RES 4 (HL)", 2, 4, RES_4_mHL) \
+	X(0x1A7, "RES 4 A", 2, 2, RES_4_A) \
+	X(0x1A8, "RES 5 B", 2, 2, RES_5_B) \
+	X(0x1A9, "RES 5 C", 2, 2, RES_5_C) \
+	X(0x1AA, "RES 5 D", 2, 2, RES_5_D) \
+	X(0x1AB, "RES 5 E", 2, 2, RES_5_E) \
+	X(0x1AC, "RES 5 H", 2, 2, RES_5_H) \
+	X(0x1AD, "RES 5 L", 2, 2, RES_5_L) \
+	X(0x1AE, "RES 5 (HL)", 2, 4, RES_5_mHL) \
+	X(0x1AF, "RES 5 A", 2, 2, RES_5_A) \
+	X(0x1B0, "RES 6 B", 2, 2, RES_6_B) \
+	X(0x1B1, "RES 6 C", 2, 2, RES_6_C) \
+	X(0x1B2, "RES 6 D", 2, 2, RES_6_D) \
+	X(0x1B3, "RES 6 E", 2, 2, RES_6_E) \
+	X(0x1B4, "RES 6 H", 2, 2, RES_6_H) \
+	X(0x1B5, "RES 6 L", 2, 2, RES_6_L) \
+	X(0x1B6, "RES 6 (HL)", 2, 4, RES_6_mHL) \
+	X(0x1B7, "RES 6 A", 2, 2, RES_6_A) \
+	X(0x1B8, "RES 7 B", 2, 2, RES_7_B) \
+	X(0x1B9, "RES 7 C", 2, 2, RES_7_C) \
+	X(0x1BA, "RES 7 D", 2, 2, RES_7_D) \
+	X(0x1BB, "RES 7 E", 2, 2, RES_7_E) \
+	X(0x1BC, "RES 7 H", 2, 2, RES_7_H) \
+	X(0x1BD, "RES 7 L", 2, 2, RES_7_L) \
+	X(0x1BE, "RES 7 (HL)", 2, 4, RES_7_mHL) \
+	X(0x1BF, "RES 7 A", 2, 2, RES_7_A) \
+	X(0x1C0, "SET 0 B", 2, 2, SET_0_B) \
+	X(0x1C1, "SET 0 C", 2, 2, SET_0_C) \
+	X(0x1C2, "SET 0 D", 2, 2, SET_0_D) \
+	X(0x1C3, "SET 0 E", 2, 2, SET_0_E) \
+	X(0x1C4, "SET 0 H", 2, 2, SET_0_H) \
+	X(0x1C5, "SET 0 L", 2, 2, SET_0_L) \
+	X(0x1C6, "SET 0 (HL)", 2, 4, SET_0_mHL) \
+	X(0x1C7, "SET 0 A", 2, 2, SET_0_A) \
+	X(0x1C8, "SET 1 B", 2, 2, SET_1_B) \
+	X(0x1C9, "SET 1 C", 2, 2, SET_1_C) \
+	X(0x1CA, "SET 1 D", 2, 2, SET_1_D) \
+	X(0x1CB, "SET 1 E", 2, 2, SET_1_E) \
+	X(0x1CC, "SET 1 H", 2, 2, SET_1_H) \
+	X(0x1CD, "SET 1 L", 2, 2, SET_1_L) \
+	X(0x1CE, "SET 1 (HL)", 2, 4, SET_1_mHL) \
+	X(0x1CF, "SET 1 A", 2, 2, SET_1_A) \
+	X(0x1D0, "SET 2 B", 2, 2, SET_2_B) \
+	X(0x1D1, "SET 2 C", 2, 2, SET_2_C) \
+	X(0x1D2, "SET 2 D", 2, 2, SET_2_D) \
+	X(0x1D3, "SET 2 E", 2, 2, SET_2_E) \
+	X(0x1D4, "SET 2 H", 2, 2, SET_2_H) \
+	X(0x1D5, "SET 2 L", 2, 2, SET_2_L) \
+	X(0x1D6, "SET 2 (HL)", 2, 4, SET_2_mHL) \
+	X(0x1D7, "SET 2 A", 2, 2, SET_2_A) \
+	X(0x1D8, "SET 3 B", 2, 2, SET_3_B) \
+	X(0x1D9, "SET 3 C", 2, 2, SET_3_C) \
+	X(0x1DA, "SET 3 D", 2, 2, SET_3_D) \
+	X(0x1DB, "SET 3 E", 2, 2, SET_3_E) \
+	X(0x1DC, "SET 3 H", 2, 2, SET_3_H) \
+	X(0x1DD, "SET 3 L", 2, 2, SET_3_L) \
+	X(0x1DE, "SET 3 (HL)", 2, 4, SET_3_mHL) \
+	X(0x1DF, "SET 3 A", 2, 2, SET_3_A) \
+	X(0x1E0, "SET 4 B", 2, 2, SET_4_B) \
+	X(0x1E1, "SET 4 C", 2, 2, SET_4_C) \
+	X(0x1E2, "SET 4 D", 2, 2, SET_4_D) \
+	X(0x1E3, "SET 4 E", 2, 2, SET_4_E) \
+	X(0x1E4, "SET 4 H", 2, 2, SET_4_H) \
+	X(0x1E5, "SET 4 L", 2, 2, SET_4_L) \
+	X(0x1E6, "SET 4 (HL)", 2, 4, SET_4_mHL) \
+	X(0x1E7, "SET 4 A", 2, 2, SET_4_A) \
+	X(0x1E8, "SET 5 B", 2, 2, SET_5_B) \
+	X(0x1E9, "SET 5 C", 2, 2, SET_5_C) \
+	X(0x1EA, "SET 5 D", 2, 2, SET_5_D) \
+	X(0x1EB, "SET 5 E", 2, 2, SET_5_E) \
+	X(0x1EC, "SET 5 H", 2, 2, SET_5_H) \
+	X(0x1ED, "SET 5 L", 2, 2, SET_5_L) \
+	X(0x1EE, "SET 5 (HL)", 2, 4, SET_5_mHL) \
+	X(0x1EF, "SET 5 A", 2, 2, SET_5_A) \
+	X(0x1F0, "SET 6 B", 2, 2, SET_6_B) \
+	X(0x1F1, "SET 6 C", 2, 2, SET_6_C) \
+	X(0x1F2, "SET 6 D", 2, 2, SET_6_D) \
+	X(0x1F3, "SET 6 E", 2, 2, SET_6_E) \
+	X(0x1F4, "SET 6 H", 2, 2, SET_6_H) \
+	X(0x1F5, "SET 6 L", 2, 2, SET_6_L) \
+	X(0x1F6, "SET 6 (HL)", 2, 4, SET_6_mHL) \
+	X(0x1F7, "SET 6 A", 2, 2, SET_6_A) \
+	X(0x1F8, "SET 7 B", 2, 2, SET_7_B) \
+	X(0x1F9, "SET 7 C", 2, 2, SET_7_C) \
+	X(0x1FA, "SET 7 D", 2, 2, SET_7_D) \
+	X(0x1FB, "SET 7 E", 2, 2, SET_7_E) \
+	X(0x1FC, "SET 7 H", 2, 2, SET_7_H) \
+	X(0x1FD, "SET 7 L", 2, 2, SET_7_L) \
+	X(0x1FE, "SET 7 (HL)", 2, 4, SET_7_mHL) \
+	X(0x1FF, "SET 7 A", 2, 2, SET_7_A) \
+	X(0x200, "INTERRUPT HANDLER", 0, 0, INTERRUPT_HANDLING) \
+	X(0x201, "PSEUDO NOP", 0, 0, NOP)
@@ -1,10 +1,5 @@
 #include "Interrupts.h"
 
-#define INTERRUPT_ENABLE_REGISTER 0xFFFF
-#define INTERRUPT_FLAG_REGISTER 0xFF0F
-
-#define INTERRUPT_REGISTER_MASK 0x1F
-
 const uint16_t JUMP_ADDRESSES[5]
 {
     0x0040,
@@ -50,19 +45,9 @@ namespace Interrupts
         memory.Write(INTERRUPT_FLAG_REGISTER, memory[INTERRUPT_FLAG_REGISTER] & ~(1 << static_cast<uint8_t>(type)));
     }
 
-    bool ShouldHandleInterrupt(Memory& memory)
-    {
-        return (memory[INTERRUPT_ENABLE_REGISTER] & memory[INTERRUPT_FLAG_REGISTER] & INTERRUPT_REGISTER_MASK) > 0;
-    }
-
-    bool ShouldHandleInterrupt(Types type, Memory& memory)
-    {
-        return (memory[INTERRUPT_ENABLE_REGISTER] & memory[INTERRUPT_FLAG_REGISTER] & INTERRUPT_REGISTER_MASK) == (1 << static_cast<uint8_t>(type));
-    }
-
     uint16_t GetJumpAddrAndClear(Memory& memory)
     {
-        uint8_t interrupts = memory[INTERRUPT_ENABLE_REGISTER] & memory[INTERRUPT_FLAG_REGISTER] & INTERRUPT_REGISTER_MASK;
+        uint8_t interrupts = memory.GetPendingInterrupts();
 
         int index = Helpers::GetFirstSetBit(interrupts);
         if( index < 0)
@@ -26,9 +26,16 @@ namespace Interrupts
 
     void ClearInterruptRequest(Types type, Memory& memory);
 
-    bool ShouldHandleInterrupt(Memory& memory);
+    // Checked after every instruction, so it only tests the pending mask cached by memory
+    inline bool ShouldHandleInterrupt(Memory& memory)
+    {
+        return memory.GetPendingInterrupts() != 0;
+    }
 
-    bool ShouldHandleInterrupt(Types type, Memory& memory);
+    inline bool ShouldHandleInterrupt(Types type, Memory& memory)
+    {
+        return memory.GetPendingInterrupts() == (1 << static_cast<uint8_t>(type));
+    }
 
     uint16_t GetJumpAddrAndClear(Memory& memory);
 }
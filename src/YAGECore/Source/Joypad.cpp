@@ -3,6 +3,7 @@
 #include "Interrupts.h"
 
 #define P1_REGISTER 0xFF00
+#define P1_UPPER_NIBBLE 0xF0
 
 bool IsActionGroupSelected(uint8_t upperNibble)
 {
@@ -14,7 +15,9 @@ bool IsDPadGroupSelected(uint8_t upperNibble)
 	return (upperNibble & 0x10) == 0;
 }
 
-Joypad::Joypad()
+Joypad::Joypad(Scheduler* scheduler)
+	: m_scheduler(scheduler)
+	, m_inputState()
 {
 }
 
@@ -29,8 +32,15 @@ void Joypad::Init(Memory& memory)
 	memory.RegisterCallback(P1_REGISTER, CheckForInterrupt, this);
 }
 
-void Joypad::Update(EmulatorInputs::InputState state, Memory& memory)
+void Joypad::SetInputState(EmulatorInputs::InputState state)
 {
+	m_inputState = state;
+	m_scheduler->ScheduleIn(SchedulerEvent::Joypad, 1);
+}
+
+void Joypad::Update(Memory& memory)
+{
+	const EmulatorInputs::InputState& state = m_inputState;
 	uint8_t upperNibble = memory[P1_REGISTER] & 0xF0;
 	if (IsActionGroupSelected(upperNibble))
 	{
@@ -44,6 +54,9 @@ void Joypad::Update(EmulatorInputs::InputState state, Memory& memory)
 	{
 		memory.WriteIO(P1_REGISTER, upperNibble | 0xF);
 	}
+
+	// P1 only changes again with new inputs or a different group selection
+	m_scheduler->Deschedule(SchedulerEvent::Joypad);
 }
 
 void Joypad::CheckForInterrupt(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
@@ -54,4 +67,10 @@ void Joypad::CheckForInterrupt(Memory* memory, uint16_t addr, uint8_t prevValue,
 	{
 		Interrupts::RequestInterrupt(Interrupts::Types::Joypad, *memory);
 	}
+
+	if (((prevValue ^ newValue) & P1_UPPER_NIBBLE) != 0)
+	{
+		Joypad* joypad = static_cast<Joypad*>(userData);
+		joypad->m_scheduler->ScheduleIn(SchedulerEvent::Joypad, 1);
+	}
 }
@@ -1,15 +1,19 @@
 #pragma once
 #include "Memory.h"
+#include "Scheduler.h"
 #include "../Include/Emulator.h"
 
 class Joypad
 {
 public:
-	Joypad();
+	explicit Joypad(Scheduler* scheduler);
 	void Init(Memory& memory);
-	void Update(EmulatorInputs::InputState state, Memory& memory);
+	void SetInputState(EmulatorInputs::InputState state);
+	void Update(Memory& memory);
 private:
 	static void CheckForInterrupt(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
 
+	Scheduler* m_scheduler;
+	EmulatorInputs::InputState m_inputState;
 };
 
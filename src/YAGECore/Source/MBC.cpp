@@ -207,8 +207,9 @@ namespace MBC_Internal
 	}
 }
 
-MemoryBankController::MemoryBankController()
+MemoryBankController::MemoryBankController(Allocator* allocator)
 	: ISerializable(nullptr, ChunkId::MBC)
+	, m_allocator(allocator)
 	, m_type(Type::None)
 	, m_hasRTC(false)
 	, m_registers()
@@ -217,17 +218,20 @@ MemoryBankController::MemoryBankController()
 	, m_rom(nullptr)
 	, m_ram(nullptr)
 	, m_onRamSave(nullptr)
+	, m_persistentDataSerializationBuffer(allocator)
 {
 }
 
-MemoryBankController::MemoryBankController(GamestateSerializer* serializer, const char* rom, uint32_t size)
+MemoryBankController::MemoryBankController(Allocator* allocator, GamestateSerializer* serializer, const char* rom, uint32_t size)
 	: ISerializable(serializer, ChunkId::MBC)
+	, m_allocator(allocator)
 	, m_type(GetTypeFromHeaderCode(rom[HEADER_CARTRIDGE_TYPE]))
 	, m_hasRTC(m_type == Type::MBC3 && MBC_Internal::MBC3::HasRTC(rom[HEADER_CARTRIDGE_TYPE]))
 	, m_registers()
 	, m_romBankCount(static_cast<uint16_t>(pow_y(2, rom[HEADER_ROM_SIZE] + 1)))
 	, m_ramBankCount(MBC_Internal::GetRAMBankCountFromHeader(rom[HEADER_RAM_SIZE]))
 	, m_onRamSave(nullptr)
+	, m_persistentDataSerializationBuffer(allocator)
 {
 
 	if (size <= HEADER_RAM_SIZE)
@@ -235,19 +239,19 @@ MemoryBankController::MemoryBankController(GamestateSerializer* serializer, cons
 		LOG_ERROR("ROM size is too small to be a proper ROM file");
 		return;
 	}
-	m_rom = Y_NEW_A(uint8_t,size);
+	m_rom = Y_NEW_A(m_allocator, uint8_t, size);
 	memcpy_y(m_rom, rom, size);
 
 	uint32_t ramSize = GetRAMSize();
-	m_ram = Y_NEW_A(uint8_t, ramSize);
+	m_ram = Y_NEW_A(m_allocator, uint8_t, ramSize);
 	memset_y(m_ram, 0, ramSize);
 
 }
 
 MemoryBankController::~MemoryBankController()
 {
-	Y_DELETE_A(m_rom);
-	Y_DELETE_A(m_ram);
+	Y_DELETE_A(m_allocator, m_rom);
+	Y_DELETE_A(m_allocator, m_ram);
 }
 
 void MemoryBankController::WriteRegister(uint16_t addr, uint8_t value)
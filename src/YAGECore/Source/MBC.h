@@ -11,8 +11,8 @@
 class MemoryBankController : ISerializable
 {
 public:
-	MemoryBankController();
-	MemoryBankController(GamestateSerializer* serializer, const char* rom, uint32_t size);
+	explicit MemoryBankController(Allocator* allocator);
+	MemoryBankController(Allocator* allocator, GamestateSerializer* serializer, const char* rom, uint32_t size);
 	virtual ~MemoryBankController();
 
 	MemoryBankController(const MemoryBankController&) = delete;
@@ -80,6 +80,7 @@ private:
 	void Deserialize(const uint8_t* data) override;
 	virtual uint32_t GetSerializationSize() override;
 
+	Allocator* m_allocator;
 	uint8_t* m_ram;
 	uint8_t* m_rom;
 	Registers m_registers;
@@ -32,24 +32,40 @@
 #define IO_REGISTERS_BEGIN 0xFF00
 #define IO_REGISTERS_END 0xFF7F
 
+#define LCD_REGISTERS_BEGIN 0xFF40
+#define LCD_REGISTERS_END 0xFF4B
+
+#define AUDIO_REGISTERS_BEGIN 0xFF10
+#define AUDIO_REGISTERS_END 0xFF3F
+
 #define DIVIDER_REGISTER 0xFF04
 
-Memory::Memory(GamestateSerializer* serializer) : ISerializable(serializer, ChunkId::Memory)
+Memory::Memory(Allocator* allocator, GamestateSerializer* serializer, Scheduler* scheduler) : ISerializable(serializer, ChunkId::Memory)
+	, m_allocator(allocator)
+	, m_scheduler(scheduler)
+#if CPU_BLOCK_CACHE
+	, m_blockCache(allocator)
+#endif
 {
-	m_mappedMemory = Y_NEW_A(uint8_t, MEMORY_SIZE);
+	m_mappedMemory = Y_NEW_A(m_allocator, uint8_t, MEMORY_SIZE);
 	m_externalMemory = false;
 #if _DEBUG
-	m_debugMemoryView = Y_NEW_A(uint8_t, MEMORY_SIZE);
+	m_debugMemoryView = Y_NEW_A(m_allocator, uint8_t, MEMORY_SIZE);
 #endif
 	Init();
 }
 
-Memory::Memory(uint8_t* rawMemory) : ISerializable(nullptr, ChunkId::Memory)
+Memory::Memory(Allocator* allocator, uint8_t* rawMemory) : ISerializable(nullptr, ChunkId::Memory)
+	, m_allocator(allocator)
+	, m_scheduler(nullptr)
+#if CPU_BLOCK_CACHE
+	, m_blockCache(allocator)
+#endif
 {
 	m_mappedMemory = rawMemory;
 	m_externalMemory = true;
 #if _DEBUG
-	m_debugMemoryView = Y_NEW_A(uint8_t, MEMORY_SIZE);
+	m_debugMemoryView = Y_NEW_A(m_allocator, uint8_t, MEMORY_SIZE);
 #endif
 	Init();
 }
@@ -58,31 +74,28 @@ Memory::~Memory()
 {
 	if (!m_externalMemory)
 	{
-		Y_DELETE_A(m_mappedMemory);
-		Y_DELETE(m_mbc);
+		Y_DELETE_A(m_allocator, m_mappedMemory);
+		Y_DELETE(m_allocator, m_mbc);
 	}
 	if (m_bootrom != nullptr)
 	{
-		Y_DELETE_A(m_bootrom);
+		Y_DELETE_A(m_allocator, m_bootrom);
 	}
 
-	Y_DELETE_A(m_writeCallbacks);
-	Y_DELETE_A(m_callbackUserData);
-
 #ifdef TRACK_UNINITIALIZED_MEMORY_READS
-	Y_DELETE_A(m_initializationTracker);
+	Y_DELETE_A(m_allocator, m_initializationTracker);
 #endif
 
 #if _DEBUG
-	Y_DELETE_A(m_debugMemoryView);
+	Y_DELETE_A(m_allocator, m_debugMemoryView);
 #endif
 }
 
-void Memory::Write(uint16_t addr, uint8_t value)
+void Memory::WriteSlow(uint16_t addr, uint8_t value)
 {
-#if _DEBUG
-	CheckForMemoryCallback(addr);
-#endif
+	SyncLCD(addr, true);
+	SyncAudio(addr);
+
 	if (m_DMAMemoryAccessBlocked && addr < IO_REGISTERS_BEGIN)
 	{
 		return;
@@ -110,6 +123,8 @@ void Memory::Write(uint16_t addr, uint8_t value)
 		if (addr <= ROM_END)
 		{
 			m_mbc->WriteRegister(addr, value);
+			// The write might have switched banks
+			UpdatePages(0, ROM_END >> MEMORY_PAGE_SHIFT);
 			return;
 		}
 		else if (addr >= EXTERNAL_RAM_BEGIN && addr < EXTERNAL_RAM_BEGIN + RAM_BANK_SIZE)
@@ -125,6 +140,11 @@ void Memory::Write(uint16_t addr, uint8_t value)
 
 	value = CheckForIOReadOnlyBitOverride(addr, value);
 
+	m_tileCache.Invalidate(addr);
+	if (addr >= OAM_START && addr <= OAM_END)
+	{
+		m_oamGeneration++;
+	}
 	WriteInternal(addr, value);
 }
 
@@ -147,6 +167,11 @@ const SpriteAttributes& Memory::ReadOAMEntry(uint8_t index) const
 	return reinterpret_cast<SpriteAttributes*>(m_mappedMemory + OAM_START)[index];
 }
 
+const uint8_t* Memory::GetOAM() const
+{
+	return m_mappedMemory + OAM_START;
+}
+
 void Memory::ClearMemory()
 {
 	memset_y(m_mappedMemory, 0, MEMORY_SIZE);
@@ -157,11 +182,16 @@ void Memory::ClearMemory()
 #endif
 
 	WriteDirect(DMA_REGISTER, 0xFF);
+	RefreshPendingInterrupts();
+	m_tileCache.InvalidateAll();
+	m_oamGeneration++;
 }
 
 void Memory::ClearRange(uint16_t start, uint16_t end)
 {
 	memset_y(m_mappedMemory + start, 0, end - start);
+	m_tileCache.InvalidateAll();
+	m_oamGeneration++;
 }
 
 void Memory::ClearVRAM()
@@ -170,11 +200,16 @@ void Memory::ClearVRAM()
 #ifdef TRACK_UNINITIALIZED_MEMORY_READS
 	memset_y(m_initializationTracker + VRAM_START, 1, VRAM_END - VRAM_START);
 #endif
+	m_tileCache.InvalidateAll();
 }
 
 void Memory::MapROM(GamestateSerializer* serializer, const char* rom, uint32_t size)
 {
-	m_mbc = Y_NEW(MemoryBankController,serializer, rom, size);
+	m_mbc = Y_NEW(m_allocator, MemoryBankController, m_allocator, serializer, rom, size);
+#if CPU_BLOCK_CACHE
+	m_blockCache.InvalidateAll();
+#endif
+	RefreshPageTable();
 
 #ifdef TRACK_UNINITIALIZED_MEMORY_READS
 	memset_y(m_initializationTracker, 1, ROM_END + 1);
@@ -189,21 +224,65 @@ void Memory::DeserializePersistentData(const char* ram, uint32_t size)
 
 void Memory::MapBootrom(const char* rom, uint32_t size)
 {
-	m_bootrom = Y_NEW_A(uint8_t, BOOTROM_SIZE);
+	m_bootrom = Y_NEW_A(m_allocator, uint8_t, BOOTROM_SIZE);
 	memcpy_y(m_bootrom, rom, size);
 	m_isBootromMapped = true;
+#if CPU_BLOCK_CACHE
+	m_blockCache.InvalidateAll();
+#endif
+	UpdatePages(0, 0);
 }
 
 void Memory::RegisterCallback(uint16_t addr, MemoryWriteCallback callback, void* userData)
 {
-	m_writeCallbacks[addr] = callback;
-	m_callbackUserData[addr] = reinterpret_cast<uint64_t>(userData);
+	if (addr < IO_REGISTERS_BEGIN)
+	{
+		LOG_ERROR(string_format("Write callbacks are only supported for IO registers, addr %x", addr).c_str());
+		return;
+	}
+
+	uint32_t index = addr & 0xFF;
+	uint8_t& count = m_ioWriteHandlerCount[index];
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		// Components register again on every load
+		if (m_ioWriteHandlers[index][i].m_callback == callback && m_ioWriteHandlers[index][i].m_userData == userData)
+		{
+			return;
+		}
+	}
+
+	if (count == MAX_IO_WRITE_HANDLERS)
+	{
+		LOG_ERROR(string_format("Too many write callbacks for addr %x", addr).c_str());
+		return;
+	}
+
+	m_ioWriteHandlers[index][count] = { callback, userData };
+	count++;
 }
 
-void Memory::DeregisterCallback(uint16_t addr)
+void Memory::DeregisterCallback(uint16_t addr, MemoryWriteCallback callback, void* userData)
 {
-	m_writeCallbacks[addr] = nullptr;
-	m_callbackUserData[addr] = 0;
+	if (addr < IO_REGISTERS_BEGIN)
+	{
+		return;
+	}
+
+	uint32_t index = addr & 0xFF;
+	uint8_t& count = m_ioWriteHandlerCount[index];
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		if (m_ioWriteHandlers[index][i].m_callback == callback && m_ioWriteHandlers[index][i].m_userData == userData)
+		{
+			for (uint32_t j = i + 1; j < count; ++j)
+			{
+				m_ioWriteHandlers[index][j - 1] = m_ioWriteHandlers[index][j];
+			}
+			count--;
+			return;
+		}
+	}
 }
 
 void Memory::RegisterRamSaveCallback(Emulator::PersistentMemoryCallback callback)
@@ -211,14 +290,61 @@ void Memory::RegisterRamSaveCallback(Emulator::PersistentMemoryCallback callback
 	m_mbc->RegisterRamSaveCallback(callback);
 }
 
+void Memory::SetLCDSyncCallback(MemorySyncCallback callback, void* userData)
+{
+	m_lcdSyncCallback = callback;
+	m_lcdSyncUserData = userData;
+}
+
+void Memory::SetLCDSyncRequired(bool required)
+{
+	if (m_lcdSyncRequired != required)
+	{
+		m_lcdSyncRequired = required;
+		UpdatePages(VRAM_START >> MEMORY_PAGE_SHIFT, VRAM_END >> MEMORY_PAGE_SHIFT);
+	}
+}
+
+void Memory::SyncLCD(uint16_t addr, bool isWrite) const
+{
+	if (m_lcdSyncRequired
+		&& ((addr >= VRAM_START && addr <= VRAM_END) || (addr >= OAM_START && addr <= OAM_END) || (addr >= LCD_REGISTERS_BEGIN && addr <= LCD_REGISTERS_END)))
+	{
+		m_lcdSyncCallback(m_lcdSyncUserData, isWrite);
+	}
+}
+
+void Memory::SetAudioSyncCallback(MemoryWriteSyncCallback callback, void* userData)
+{
+	m_audioSyncCallback = callback;
+	m_audioSyncUserData = userData;
+}
+
+// Reads don't need to sync, the APU only changes the registers at frame sequencer steps, which are scheduled events
+void Memory::SyncAudio(uint16_t addr) const
+{
+	if (m_audioSyncCallback && addr >= AUDIO_REGISTERS_BEGIN && addr <= AUDIO_REGISTERS_END)
+	{
+		m_audioSyncCallback(m_audioSyncUserData);
+	}
+}
+
 void Memory::SetVRamReadAccess(VRamAccess access)
 {
-	m_vRamReadAccess = access;
+	if (m_vRamReadAccess != access)
+	{
+		m_vRamReadAccess = access;
+		UpdatePages(VRAM_START >> MEMORY_PAGE_SHIFT, VRAM_END >> MEMORY_PAGE_SHIFT);
+	}
 }
 
 void Memory::SetVRamWriteAccess(VRamAccess access)
 {
-	m_vRamWriteAccess = access;
+	if (m_vRamWriteAccess != access)
+	{
+		m_vRamWriteAccess = access;
+		UpdatePages(VRAM_START >> MEMORY_PAGE_SHIFT, VRAM_END >> MEMORY_PAGE_SHIFT);
+	}
 }
 
 uint8_t Memory::GetHeaderChecksum() const
@@ -235,36 +361,53 @@ void Memory::Init()
 	m_DMAStatus = DMAStatus::Idle;
 	m_DMAProgress = 0;
 	m_DMAMemoryAccessBlocked = false;
+	m_pendingInterrupts = 0;
+	m_oamGeneration = 0;
+
+	m_lcdSyncCallback = nullptr;
+	m_lcdSyncUserData = nullptr;
+	m_lcdSyncRequired = false;
+
+	m_audioSyncCallback = nullptr;
+	m_audioSyncUserData = nullptr;
+
+	m_vRamReadAccess = VRamAccess::All;
+	m_vRamWriteAccess = VRamAccess::All;
+
+	memset_y(m_readPages, 0, sizeof(m_readPages));
+	memset_y(m_writePages, 0, sizeof(m_writePages));
 
 	memset_y(m_unusedIOBitsOverride, 0, IOPORTS_COUNT);
 	memset_y(m_writeOnlyIOBitsOverride, 0, IOPORTS_COUNT);
 	memset_y(m_readOnlyIOBitsOverride, 0, IOPORTS_COUNT);
 
-	m_writeCallbacks = Y_NEW_A(MemoryWriteCallback, MEMORY_SIZE);
-	memset_y(m_writeCallbacks, 0, sizeof(MemoryWriteCallback) * MEMORY_SIZE);
-
-	m_callbackUserData = Y_NEW_A(uint64_t, MEMORY_SIZE);
-	memset_y(m_callbackUserData, 0, sizeof(uint64_t) * MEMORY_SIZE);
+	memset_y(m_ioWriteHandlers, 0, sizeof(m_ioWriteHandlers));
+	memset_y(m_ioWriteHandlerCount, 0, sizeof(m_ioWriteHandlerCount));
 
 	RegisterCallback(DMA_REGISTER, DoDMA, nullptr);
 	RegisterCallback(BOOTROM_BANK, UnmapBootrom, nullptr);
-
-	m_vRamReadAccess = VRamAccess::All;
-	m_vRamWriteAccess = VRamAccess::All;
+	RegisterCallback(INTERRUPT_ENABLE_REGISTER, InterruptRegisterWrite, nullptr);
+	RegisterCallback(INTERRUPT_FLAG_REGISTER, InterruptRegisterWrite, nullptr);
 
 	RegisterUnusedIORegisters();
 
 #ifdef TRACK_UNINITIALIZED_MEMORY_READS
-	m_initializationTracker = Y_NEW_A(uint8_t, MEMORY_SIZE);
+	m_initializationTracker = Y_NEW_A(m_allocator, uint8_t, MEMORY_SIZE);
 	memset_y(m_initializationTracker, 0, MEMORY_SIZE);
 	//skip initialization checks for APU wave ram
 	memset_y(m_initializationTracker + 0xFF30, 1, 0xFF3F - 0xFF30 + 1);
 #endif
+
+	RefreshPageTable();
 }
 
 void Memory::DoDMA(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
 {
 	memory->m_DMAStatus = DMAStatus::Initializing;
+	if (memory->m_scheduler != nullptr)
+	{
+		memory->m_scheduler->ScheduleIn(SchedulerEvent::DMA, 1);
+	}
 
 #ifdef TRACK_UNINITIALIZED_MEMORY_READS
 	memset_y(memory->m_initializationTracker + OAM_START, 1, OAM_SIZE);
@@ -274,6 +417,17 @@ void Memory::DoDMA(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t new
 void Memory::UnmapBootrom(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
 {
 	memory->m_isBootromMapped = false;
+	memory->UpdatePages(0, 0);
+}
+
+void Memory::InterruptRegisterWrite(Memory* memory, uint16_t, uint8_t, uint8_t, void*)
+{
+	memory->RefreshPendingInterrupts();
+}
+
+void Memory::RefreshPendingInterrupts()
+{
+	m_pendingInterrupts = m_mappedMemory[INTERRUPT_ENABLE_REGISTER] & m_mappedMemory[INTERRUPT_FLAG_REGISTER] & INTERRUPT_REGISTER_MASK;
 }
 
 void Memory::Update()
@@ -287,11 +441,11 @@ void Memory::Update()
 	}
 	else if (m_DMAStatus == DMAStatus::InProgress)
 	{
-		m_DMAMemoryAccessBlocked = true;
+		SetDMAMemoryAccessBlocked(true);
 		m_DMAProgress++;
 		if (m_DMAProgress == DMA_DURATION - 1)
 		{
-			uint16_t source = static_cast<uint16_t>((*this)[DMA_REGISTER]) << 8;
+			uint16_t source = static_cast<uint16_t>(ReadIO(DMA_REGISTER)) << 8;
 
 			if (source >= ECHO_RAM_BEGIN)
 			{
@@ -306,15 +460,28 @@ void Memory::Update()
 			{
 				memcpy_y(m_mappedMemory + OAM_START, m_mappedMemory + source, OAM_SIZE);
 			}
+			m_oamGeneration++;
 			m_DMAStatus = DMAStatus::Idle;
 			m_DMAProgress = 0;
-			m_DMAMemoryAccessBlocked = false;
+			SetDMAMemoryAccessBlocked(false);
 		}
 	}
+
+	// The transfer advances every m-cycle until it is done
+	if (m_DMAStatus != DMAStatus::Idle)
+	{
+		m_scheduler->ScheduleIn(SchedulerEvent::DMA, 1);
+	}
+	else
+	{
+		m_scheduler->Deschedule(SchedulerEvent::DMA);
+	}
 }
 
-uint8_t Memory::operator[](uint16_t addr) const
+uint8_t Memory::ReadSlow(uint16_t addr) const
 {
+	SyncLCD(addr, false);
+
 	if (m_DMAMemoryAccessBlocked && addr < IO_REGISTERS_BEGIN && addr >= OAM_START)
 	{
 		return 0xFF;
@@ -373,6 +540,116 @@ uint8_t Memory::operator[](uint16_t addr) const
 	return memoryVal;
 }
 
+void Memory::RefreshPageTable()
+{
+	UpdatePages(0, MEMORY_PAGE_COUNT - 1);
+}
+
+void Memory::UpdatePages(uint32_t firstPage, uint32_t lastPage)
+{
+	for (uint32_t page = firstPage; page <= lastPage; ++page)
+	{
+#ifdef TRACK_UNINITIALIZED_MEMORY_READS
+		// Every access has to go through the initialization tracker
+		m_readPages[page] = nullptr;
+		m_writePages[page] = nullptr;
+#else
+		uint16_t addr = static_cast<uint16_t>(page << MEMORY_PAGE_SHIFT);
+		m_readPages[page] = GetReadPage(addr);
+		m_writePages[page] = GetWritePage(addr);
+#endif
+	}
+
+#if CPU_BLOCK_CACHE
+	static_assert(BLOCK_CACHE_PAGE_SHIFT == MEMORY_PAGE_SHIFT, "The block cache has to use the pages of the page table");
+	// Bank switches land here as well, code from external memory is writable and never cached
+	for (uint32_t page = firstPage; page <= lastPage && page < BLOCK_CACHE_PAGE_COUNT; ++page)
+	{
+		m_blockCache.MapPage(page, m_externalMemory ? nullptr : GetReadPage(static_cast<uint16_t>(page << MEMORY_PAGE_SHIFT)));
+	}
+#endif
+}
+
+// Mirrors the checks in ReadSlow, a page is only mapped directly if none of them can apply to any address in it
+const uint8_t* Memory::GetReadPage(uint16_t addr) const
+{
+	if (addr >= OAM_START || addr == ECHO_RAM_BEGIN)
+	{
+		return nullptr;
+	}
+
+	if (addr >= VRAM_START && addr <= VRAM_END && (m_vRamReadAccess == VRamAccess::VRamOAMBlocked || m_lcdSyncRequired))
+	{
+		return nullptr;
+	}
+
+	if (m_externalMemory)
+	{
+		return m_mappedMemory + addr;
+	}
+
+	if (m_isBootromMapped && addr < BOOTROM_SIZE)
+	{
+		return m_bootrom + addr;
+	}
+
+	if (addr <= ROM_END)
+	{
+		return m_mbc != nullptr ? m_mbc->GetROMMemoryOffset(addr) : nullptr;
+	}
+
+	if (addr >= EXTERNAL_RAM_BEGIN && addr < EXTERNAL_RAM_BEGIN + RAM_BANK_SIZE)
+	{
+		return nullptr;
+	}
+
+	return m_mappedMemory + addr;
+}
+
+// Mirrors the checks in WriteSlow, write handlers only exist for the IO page which never maps directly.
+// Writes to tile data always take the slow path, they have to invalidate the tile cache.
+uint8_t* Memory::GetWritePage(uint16_t addr) const
+{
+	if (m_DMAMemoryAccessBlocked || addr >= OAM_START || addr == ECHO_RAM_BEGIN)
+	{
+		return nullptr;
+	}
+
+	if (addr >= TILE_CACHE_START && addr <= TILE_CACHE_END)
+	{
+		return nullptr;
+	}
+
+	if (addr >= VRAM_START && addr <= VRAM_END && m_lcdSyncRequired)
+	{
+		return nullptr;
+	}
+
+	if (!m_externalMemory)
+	{
+		if (addr >= VRAM_START && addr <= VRAM_END && m_vRamWriteAccess == VRamAccess::VRamOAMBlocked)
+		{
+			return nullptr;
+		}
+
+		if (addr <= ROM_END || (addr >= EXTERNAL_RAM_BEGIN && addr < EXTERNAL_RAM_BEGIN + RAM_BANK_SIZE))
+		{
+			return nullptr;
+		}
+	}
+
+	return m_mappedMemory + addr;
+}
+
+void Memory::SetDMAMemoryAccessBlocked(bool blocked)
+{
+	if (m_DMAMemoryAccessBlocked != blocked)
+	{
+		m_DMAMemoryAccessBlocked = blocked;
+		RefreshPageTable();
+	}
+}
+
 //IO Register read function that skips unused bits and write only overrides
 uint8_t Memory::ReadIO(uint16_t addr) const
 {
@@ -423,6 +700,10 @@ void Memory::Deserialize(const uint8_t* data)
 	ReadAndMove(data, &m_DMAStatus, sizeof(uint8_t));
 	ReadAndMove(data, &m_DMAProgress, sizeof(uint8_t));
 	ReadAndMove(data, &m_DMAMemoryAccessBlocked, sizeof(bool));
+
+	RefreshPendingInterrupts();
+	m_tileCache.InvalidateAll();
+	m_oamGeneration++;
 }
 
 uint32_t Memory::GetSerializationSize()
@@ -435,9 +716,14 @@ inline void Memory::WriteInternal(uint16_t addr, uint8_t value)
 	uint8_t prevValue = m_mappedMemory[addr];
 	m_mappedMemory[addr] = value;
 
-	if (m_writeCallbacks[addr] != nullptr)
+	if (addr >= IO_REGISTERS_BEGIN)
 	{
-		m_writeCallbacks[addr](this, addr, prevValue, value, reinterpret_cast<void*>(m_callbackUserData[addr]));
+		uint32_t index = addr & 0xFF;
+		for (uint32_t i = 0; i < m_ioWriteHandlerCount[index]; ++i)
+		{
+			const IOWriteHandler& handler = m_ioWriteHandlers[index][i];
+			handler.m_callback(this, addr, prevValue, value, handler.m_userData);
+		}
 	}
 
 #ifdef TRACK_UNINITIALIZED_MEMORY_READS
@@ -3,9 +3,19 @@
 #include "../Include/Emulator.h"
 #include "MBC.h"
 #include "Serialization.h"
+#include "Scheduler.h"
+#include "TileCache.h"
+#include "BlockCache.h"
 
 #define MEMORY_SIZE 0x10000
 #define IOPORTS_COUNT 0x80
+#define INTERRUPT_ENABLE_REGISTER 0xFFFF
+#define INTERRUPT_FLAG_REGISTER 0xFF0F
+#define INTERRUPT_REGISTER_MASK 0x1F
+
+// Write handlers cover the IO ports, HRAM and the interrupt enable register
+#define IO_HANDLER_COUNT 0x100
+#define MAX_IO_WRITE_HANDLERS 4
 #define BOOTROM_SIZE 0x100
 #define EXTERNAL_RAM_SIZE 0x2000
 
@@ -21,9 +31,16 @@
 
 #define MAX_DELAYED_WRITES 5
 
+// The bus is split into 256 byte pages for the fast path lookup
+#define MEMORY_PAGE_COUNT 0x100
+#define MEMORY_PAGE_SHIFT 8
+#define MEMORY_PAGE_MASK 0xFF
+
 class Memory;
 
 typedef void(*MemoryWriteCallback)(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
+typedef void(*MemorySyncCallback)(void* userData, bool isWrite);
+typedef void(*MemoryWriteSyncCallback)(void* userData);
 
 struct SpriteAttributes
 {
@@ -57,9 +74,9 @@ public:
 		VRamOAMBlocked = 2,
 	};
 
-	explicit Memory(GamestateSerializer* serializer);
+	Memory(Allocator* allocator, GamestateSerializer* serializer, Scheduler* scheduler);
 
-	explicit Memory(uint8_t* rawMemory);
+	Memory(Allocator* allocator, uint8_t* rawMemory);
 
 	~Memory();
 
@@ -68,16 +85,58 @@ public:
 
 	void Update();
 
-	uint8_t operator[](uint16_t addr) const;
+	uint8_t operator[](uint16_t addr) const
+	{
+		const uint8_t* page = m_readPages[addr >> MEMORY_PAGE_SHIFT];
+		if (page != nullptr)
+		{
+			return page[addr & MEMORY_PAGE_MASK];
+		}
+		return ReadSlow(addr);
+	}
+
+	void Write(uint16_t addr, uint8_t value)
+	{
+#if _DEBUG
+		CheckForMemoryCallback(addr);
+#endif
+		uint8_t* page = m_writePages[addr >> MEMORY_PAGE_SHIFT];
+		if (page != nullptr)
+		{
+			page[addr & MEMORY_PAGE_MASK] = value;
+			return;
+		}
+		WriteSlow(addr, value);
+	}
 
-	void Write(uint16_t addr, uint8_t value);
 	void WriteDirect(uint16_t addr, uint8_t value);
 	uint8_t ReadDirect(uint16_t addr) const;
 
+	// Color indices of the 8 pixels of the tile data row at addr
+	const uint8_t* GetTileRow(uint16_t addr)
+	{
+		return m_tileCache.GetRow(addr, m_mappedMemory);
+	}
+
+#if CPU_BLOCK_CACHE
+	// Predecoded ROM code, nullptr when the CPU has to fetch pc through the bus
+	const BlockCache::Instruction* FetchInstruction(uint16_t pc)
+	{
+		return m_blockCache.Fetch(pc);
+	}
+#endif
+
 	uint8_t ReadIO(uint16_t addr) const;
 	void WriteIO(uint16_t addr, uint8_t value);
 
 	const SpriteAttributes& ReadOAMEntry(uint8_t index) const;
+	const uint8_t* GetOAM() const;
+
+	// Changes whenever anything in OAM might have been written
+	uint32_t GetOAMGeneration() const
+	{
+		return m_oamGeneration;
+	}
 
 	void ClearMemory();
 	void ClearRange(uint16_t start, uint16_t end);
@@ -87,15 +146,31 @@ public:
 	void DeserializePersistentData(const char* ram, uint32_t size);
 	void MapBootrom(const char* rom, uint32_t size);
 
+	// Several components can subscribe to the same register, handlers are called in registration order
 	void RegisterCallback(uint16_t addr, MemoryWriteCallback callback, void* userData);
-	void DeregisterCallback(uint16_t addr);
+	void DeregisterCallback(uint16_t addr, MemoryWriteCallback callback, void* userData);
 
 	void RegisterRamSaveCallback(Emulator::PersistentMemoryCallback callback);
 
+	// While the PPU lags behind or has drawn a scanline ahead, accesses to VRAM, OAM & the LCD registers call back first
+	void SetLCDSyncCallback(MemorySyncCallback callback, void* userData);
+	void SetLCDSyncRequired(bool required);
+
+	// Writes to the sound registers & wave RAM call back first, so the APU can catch up on the cycles before the write
+	void SetAudioSyncCallback(MemoryWriteSyncCallback callback, void* userData);
+
 	void SetVRamReadAccess(VRamAccess access);
 	void SetVRamWriteAccess(VRamAccess access);
 	uint8_t GetHeaderChecksum() const;
 
+	// IE & IF, kept up to date by the write handlers of both registers
+	uint8_t GetPendingInterrupts() const
+	{
+		return m_pendingInterrupts;
+	}
+
+	void RefreshPageTable();
+
 	void AddIOUnusedBitsOverride(uint16_t addr, uint8_t mask);
 	void AddIOReadOnlyBitsOverride(uint16_t addr, uint8_t mask);
 	void AddIOWriteOnlyBitsOverride(uint16_t addr, uint8_t mask);
@@ -115,13 +190,25 @@ private:
 
 	static void DoDMA(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
 	static void UnmapBootrom(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
+	static void InterruptRegisterWrite(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
+	void RefreshPendingInterrupts();
 
 	void Serialize(uint8_t* data) override;
 	void Deserialize(const uint8_t* data) override;
 	virtual uint32_t GetSerializationSize() override;
 
+	uint8_t ReadSlow(uint16_t addr) const;
+	void WriteSlow(uint16_t addr, uint8_t value);
 	void WriteInternal(uint16_t addr, uint8_t value);
 
+	void UpdatePages(uint32_t firstPage, uint32_t lastPage);
+	const uint8_t* GetReadPage(uint16_t addr) const;
+	uint8_t* GetWritePage(uint16_t addr) const;
+	void SetDMAMemoryAccessBlocked(bool blocked);
+
+	void SyncLCD(uint16_t addr, bool isWrite) const;
+	void SyncAudio(uint16_t addr) const;
+
 	uint8_t CheckForIOUnusedBitOverride(uint16_t addr, uint8_t readValue) const;
 	uint8_t CheckForIOWriteOnlyBitOverride(uint16_t addr, uint8_t readValue) const;
 	uint8_t CheckForIOReadOnlyBitOverride(uint16_t addr, uint8_t readValue) const;
@@ -145,11 +232,19 @@ private:
 	  FFFF        Interrupt Enable Register
 	*/
 
+	Allocator* m_allocator;
+	Scheduler* m_scheduler;
 	uint8_t* m_mappedMemory;
 	uint8_t* m_bootrom;
 
-	MemoryWriteCallback* m_writeCallbacks;
-	uint64_t* m_callbackUserData;
+	struct IOWriteHandler
+	{
+		MemoryWriteCallback m_callback;
+		void* m_userData;
+	};
+
+	IOWriteHandler m_ioWriteHandlers[IO_HANDLER_COUNT][MAX_IO_WRITE_HANDLERS];
+	uint8_t m_ioWriteHandlerCount[IO_HANDLER_COUNT];
 	MemoryBankController* m_mbc;
 
 	VRamAccess m_vRamReadAccess;
@@ -168,6 +263,25 @@ private:
 	uint8_t m_DMAProgress;
 	bool m_DMAMemoryAccessBlocked;
 
+	uint8_t m_pendingInterrupts;
+
+	TileCache m_tileCache;
+#if CPU_BLOCK_CACHE
+	BlockCache m_blockCache;
+#endif
+	uint32_t m_oamGeneration;
+
+	MemorySyncCallback m_lcdSyncCallback;
+	void* m_lcdSyncUserData;
+	bool m_lcdSyncRequired;
+
+	MemoryWriteSyncCallback m_audioSyncCallback;
+	void* m_audioSyncUserData;
+
+	// Pages that map straight to memory without any side effects, nullptr takes the slow path
+	const uint8_t* m_readPages[MEMORY_PAGE_COUNT];
+	uint8_t* m_writePages[MEMORY_PAGE_COUNT];
+
 	//Unused bits in IO ports return 1 when read
 	uint8_t m_unusedIOBitsOverride[IOPORTS_COUNT];
 	//read only bits in IO ports ignore writes
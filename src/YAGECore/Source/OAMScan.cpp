@@ -0,0 +1,99 @@
+#include "OAMScan.h"
+
+#if OAM_SCAN_SIMD && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define OAM_SCAN_SSE2 1
+#include <emmintrin.h>
+#elif OAM_SCAN_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+#define OAM_SCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+#define SPRITE_SINGLE_SIZE 8
+#define SPRITE_DOUBLE_SIZE 16
+
+namespace
+{
+	// A sprite overlaps the line if lineY + height - 16 < posY <= lineY + 16. Relative to the lowest position that is still in the line,
+	// that is a single unsigned comparison as positions above it wrap around to values far larger than the sprite height.
+	uint8_t GetLowestPosition(uint8_t lineY, bool doubleSize)
+	{
+		return static_cast<uint8_t>(lineY + (doubleSize ? 0 : SPRITE_SINGLE_SIZE) + 1);
+	}
+
+	uint8_t GetHeight(bool doubleSize)
+	{
+		return doubleSize ? SPRITE_DOUBLE_SIZE : SPRITE_SINGLE_SIZE;
+	}
+}
+
+uint64_t OAMScan::FindSpritesInLineScalar(const uint8_t* oam, uint8_t lineY, bool doubleSize)
+{
+	uint8_t lowestPosition = GetLowestPosition(lineY, doubleSize);
+	uint8_t height = GetHeight(doubleSize);
+
+	uint64_t sprites = 0;
+	for (uint32_t i = 0; i < OAM_ENTRY_COUNT; ++i)
+	{
+		uint8_t offset = static_cast<uint8_t>(oam[i * OAM_ENTRY_SIZE] - lowestPosition);
+		sprites |= static_cast<uint64_t>(offset < height) << i;
+	}
+	return sprites;
+}
+
+#if OAM_SCAN_SSE2
+
+// 16 bytes hold 4 entries, every byte is compared and only the Y positions are kept from the resulting mask
+uint64_t OAMScan::FindSpritesInLine(const uint8_t* oam, uint8_t lineY, bool doubleSize)
+{
+	const __m128i lowestPosition = _mm_set1_epi8(static_cast<char>(GetLowestPosition(lineY, doubleSize)));
+	const __m128i maxOffset = _mm_set1_epi8(static_cast<char>(GetHeight(doubleSize) - 1));
+
+	uint64_t sprites = 0;
+	for (uint32_t i = 0; i < OAM_ENTRY_COUNT / 4; ++i)
+	{
+		__m128i entries = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oam + i * 16));
+		__m128i offset = _mm_sub_epi8(entries, lowestPosition);
+		// There is no unsigned byte comparison, offset <= maxOffset is the same as min(offset, maxOffset) == offset
+		__m128i isInLine = _mm_cmpeq_epi8(_mm_min_epu8(offset, maxOffset), offset);
+
+		// Bits 0, 4, 8 & 12 are the Y positions, the multiplication gathers them in bits 12 to 15 without any carries
+		uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(isInLine)) & 0x1111;
+		sprites |= static_cast<uint64_t>(((mask * 0x1248) >> 12) & 0xF) << (i * 4);
+	}
+	return sprites;
+}
+
+#elif OAM_SCAN_NEON
+
+// The structure loads split 16 (or 8) entries into one register per attribute, so the Y positions get compared on their own
+uint64_t OAMScan::FindSpritesInLine(const uint8_t* oam, uint8_t lineY, bool doubleSize)
+{
+	static const uint8_t bitWeights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	const uint8x16_t weights = vld1q_u8(bitWeights);
+	const uint8x16_t lowestPosition = vdupq_n_u8(GetLowestPosition(lineY, doubleSize));
+	const uint8x16_t height = vdupq_n_u8(GetHeight(doubleSize));
+
+	uint64_t sprites = 0;
+	for (uint32_t i = 0; i < 2; ++i)
+	{
+		uint8x16x4_t entries = vld4q_u8(oam + i * 16 * OAM_ENTRY_SIZE);
+		uint8x16_t isInLine = vcltq_u8(vsubq_u8(entries.val[0], lowestPosition), height);
+		uint8x16_t bits = vandq_u8(isInLine, weights);
+		sprites |= static_cast<uint64_t>(vaddv_u8(vget_low_u8(bits))) << (i * 16);
+		sprites |= static_cast<uint64_t>(vaddv_u8(vget_high_u8(bits))) << (i * 16 + 8);
+	}
+
+	uint8x8x4_t lastEntries = vld4_u8(oam + 32 * OAM_ENTRY_SIZE);
+	uint8x8_t isInLine = vclt_u8(vsub_u8(lastEntries.val[0], vget_low_u8(lowestPosition)), vget_low_u8(height));
+	sprites |= static_cast<uint64_t>(vaddv_u8(vand_u8(isInLine, vget_low_u8(weights)))) << 32;
+	return sprites;
+}
+
+#else
+
+uint64_t OAMScan::FindSpritesInLine(const uint8_t* oam, uint8_t lineY, bool doubleSize)
+{
+	return FindSpritesInLineScalar(oam, lineY, doubleSize);
+}
+
+#endif
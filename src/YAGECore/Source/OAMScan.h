@@ -0,0 +1,19 @@
+#pragma once
+#include "CppIncludes.h"
+
+#define OAM_ENTRY_COUNT 40
+#define OAM_ENTRY_SIZE 4
+
+// 1 compares the Y positions of all OAM entries with SSE2 or NEON where the target has them, 0 always one entry at a time
+#ifndef OAM_SCAN_SIMD
+#define OAM_SCAN_SIMD 1
+#endif
+
+namespace OAMScan
+{
+	// Bit n of the result is set if OAM entry n overlaps the given line. oam points to the 40 entries of 4 bytes, Y position first
+	uint64_t FindSpritesInLine(const uint8_t* oam, uint8_t lineY, bool doubleSize);
+
+	// Same as FindSpritesInLine, one entry at a time
+	uint64_t FindSpritesInLineScalar(const uint8_t* oam, uint8_t lineY, bool doubleSize);
+}
@@ -22,9 +22,29 @@
 #define MAX_LINES_Y 154
 #define VBLANK_START_LINE_Y 144
 
+// Deferred updates stop this many m-cycles before the end of the line, by then the PPU is settled in HBlank
+#define CATCH_UP_LINE_END_MARGIN 4
+
 #define SPRITE_SINGLE_SIZE 8
 #define SPRITE_DOUBLE_SIZE 16
 
+#define TILE_MAP_1 0x9800
+#define TILE_MAP_2 0x9C00
+#define TILE_DATA_BLOCK_1 0x8000
+#define TILE_DATA_BLOCK_2 0x8800
+#define TILE_DATA_BLOCK_3 0x9000
+#define TILE_MAP_DIMENSIONS 32
+#define TILE_BYTE_SIZE 16
+#define TILE_SIZE 8
+
+#define SPRITE_FLAG_PALETTE 4
+#define SPRITE_FLAG_X_FLIP 5
+#define SPRITE_FLAG_Y_FLIP 6
+#define SPRITE_FLAG_BG_PRIORITY 7
+
+// The sprite FIFO holds at most 9 pixels, the last fetch of a line can start at x 158
+#define SCANLINE_SPRITE_BUFFER_SIZE (EmulatorConstants::SCREEN_WIDTH + 2 * TILE_SIZE)
+
 const RGBA SCREEN_COLORS[4]
 {
 	{0xE0, 0xF8, 0xD8, 0xFF},
@@ -43,6 +63,11 @@ enum class StatFlags : uint32_t
 	LCYEqLCInterrupt = 6
 };
 
+const uint8_t DISABLED_BACKGROUND_SHADES[4]
+{
+	0, 0, 0, 0
+};
+
 const StatFlags ModeIndexToStatFlags[3]
 {
 	StatFlags::Mode0Interrupt,
@@ -52,10 +77,9 @@ const StatFlags ModeIndexToStatFlags[3]
 
 namespace PPUHelpers
 {
-	RGBA ResolvePixelColor(uint8_t colorIndex, uint16_t paletteAddr, Memory& memory)
+	uint8_t ResolvePixelShade(uint8_t colorIndex, uint16_t paletteAddr, Memory& memory)
 	{
-		colorIndex = (memory[paletteAddr] >> (colorIndex * 2)) & 0x3;
-		return SCREEN_COLORS[colorIndex];
+		return (memory[paletteAddr] >> (colorIndex * 2)) & 0x3;
 	}
 
 	bool IsControlFlagSet(LCDControlFlags flag, Memory& memory)
@@ -88,6 +112,38 @@ namespace PPUHelpers
 		return memory.ReadIO(STAT_REGISTER) & 0x03;
 	}
 
+	// Background & window pixels [begin, end) of a line, skipping the first pixels of the tile row like the fine scroll does
+	void DrawTileRow(uint8_t* line, uint8_t begin, uint8_t end, uint8_t skip, uint16_t tileMapRowAddr, uint8_t firstTileX, bool wrapTileX,
+		uint8_t tileY, bool isUnsignedAddressing, const uint8_t* shades, Memory& memory)
+	{
+		const uint8_t* tileRow = nullptr;
+		uint32_t currentTile = SCANLINE_DURATION;
+		for (uint32_t x = begin; x < end; ++x)
+		{
+			uint32_t rowX = x - begin + skip;
+			if (rowX / TILE_SIZE != currentTile)
+			{
+				currentTile = rowX / TILE_SIZE;
+				uint16_t tilePosX = firstTileX + currentTile;
+				if (wrapTileX)
+				{
+					tilePosX &= TILE_MAP_DIMENSIONS - 1;
+				}
+
+				uint8_t tileIndex = memory.ReadDirect(tileMapRowAddr + tilePosX);
+				uint16_t tileAddr = isUnsignedAddressing ? TILE_DATA_BLOCK_1 : TILE_DATA_BLOCK_3;
+				if (!isUnsignedAddressing && tileIndex > 127)
+				{
+					tileAddr = TILE_DATA_BLOCK_2;
+					tileIndex -= 128;
+				}
+				tileAddr += tileIndex * TILE_BYTE_SIZE + tileY * 2;
+				tileRow = memory.GetTileRow(tileAddr);
+			}
+			line[x] = shades[tileRow[rowX % TILE_SIZE]];
+		}
+	}
+
 	bool IsNewScanline(uint32_t totalCycles, uint8_t& currentLine, Memory& memory)
 	{
 		uint8_t newLineY = totalCycles / SCANLINE_DURATION;
@@ -100,23 +156,48 @@ namespace PPUHelpers
 	}
 }
 
-PPU::PPU(GamestateSerializer* serializer) : ISerializable(serializer, ChunkId::PPU)
+PPU::PPU(Allocator* allocator, GamestateSerializer* serializer, Scheduler* scheduler) : ISerializable(serializer, ChunkId::PPU)
 	, data()
+	, m_allocator(allocator)
+	, m_scheduler(scheduler)
+	, m_memory(nullptr)
+	, m_lineShades()
+	, m_backgroundShades()
+	, m_output()
+	, m_isExternalOutput(false)
+	, m_frameReadyCallback(nullptr)
+	, m_frameReadyUserData(nullptr)
+	, m_renderInterval(1)
+	, m_isFrameSkipped(false)
+	, m_syncedCycle(0)
+	, m_completedFrames(0)
+	, m_syncMode(SyncMode::EveryCycle)
+	, m_isRendering(false)
+	, m_accuracy(EmulatorSettings::PPUAccuracy::PixelFIFO)
+	, m_scanline()
+	, m_oamScan()
+	, m_lineSpriteOrder()
 {
-	m_activeFrame = Y_NEW_A(RGBA, EmulatorConstants::SCREEN_SIZE);
-	m_backBuffer = Y_NEW_A(RGBA, EmulatorConstants::SCREEN_SIZE);
+	m_activeFrame = Y_NEW_A(m_allocator, RGBA, EmulatorConstants::SCREEN_SIZE);
+	m_backBuffer = Y_NEW_A(m_allocator, RGBA, EmulatorConstants::SCREEN_SIZE);
+	m_output.SetTarget(m_activeFrame, EmulatorConstants::SCREEN_WIDTH * sizeof(RGBA), EmulatorSettings::PixelFormat::RGBA8888, SCREEN_COLORS);
 }
 
 PPU::~PPU()
 {
-	Y_DELETE_A(m_activeFrame);
-	Y_DELETE_A(m_backBuffer);
+	Y_DELETE_A(m_allocator, m_activeFrame);
+	Y_DELETE_A(m_allocator, m_backBuffer);
 }
 
 void PPU::Init(Memory& memory)
 {
+	m_memory = &memory;
+	memory.SetLCDSyncCallback(LCDAccess, this);
 	memory.RegisterCallback(BGP_REGISTER, CacheBackgroundPalette, this);
 	memory.RegisterCallback(LCDC_REGISTER, LCDCWrite, this);
+	memory.RegisterCallback(STAT_REGISTER, StatusRegisterWrite, this);
+	memory.RegisterCallback(LY_REGISTER, StatusRegisterWrite, this);
+	memory.RegisterCallback(LYC_REGISTER, StatusRegisterWrite, this);
 
 	memory.WriteIO(LCDC_REGISTER, 0x91);
 	memory.WriteIO(STAT_REGISTER, 0x85);
@@ -137,6 +218,166 @@ void PPU::Init(Memory& memory)
 
 	TransitionToOAMScan(memory, 0);
 	data.m_stateTransition = StateTransition::Cycle1;
+
+	m_scanline.m_active = false;
+	m_isFrameSkipped = m_renderInterval == 0;
+	ResetSync();
+}
+
+void PPU::Update(uint32_t tCycles, Memory& memory)
+{
+	uint64_t currentCycle = m_scheduler->GetCurrentCycle();
+	CatchUp(currentCycle - 1);
+
+	StateTransition startTransition = data.m_stateTransition;
+	m_isRendering = true;
+	Render(tCycles, memory);
+	m_isRendering = false;
+	m_syncedCycle = currentCycle;
+
+	if (tCycles == MCYCLES_TO_CYCLES)
+	{
+		ScheduleNextUpdate(memory, startTransition);
+	}
+	else
+	{
+		SetSyncMode(SyncMode::EveryCycle);
+	}
+}
+
+void PPU::Sync()
+{
+	CatchUp(m_scheduler->GetCurrentCycle());
+}
+
+// Components that are updated before the PPU within an m-cycle only get to see the previous one
+void PPU::SyncToPreviousCycle()
+{
+	CatchUp(m_scheduler->GetCurrentCycle() - 1);
+}
+
+void PPU::ResetSync()
+{
+	m_syncedCycle = m_scheduler->GetCurrentCycle();
+	SetSyncMode(SyncMode::EveryCycle);
+	m_scheduler->ScheduleIn(SchedulerEvent::PPU, 1);
+}
+
+bool PPU::IsCatchingUp() const
+{
+	return m_syncMode == SyncMode::CatchUp;
+}
+
+void PPU::SetAccuracy(EmulatorSettings::PPUAccuracy accuracy)
+{
+	m_accuracy = accuracy;
+	if (accuracy == EmulatorSettings::PPUAccuracy::PixelFIFO)
+	{
+		Sync();
+		FallBackToFIFO();
+	}
+}
+
+void PPU::CatchUp(uint64_t cycle)
+{
+	// The PPU's own register accesses must not recurse into another catch up
+	if (cycle <= m_syncedCycle || m_isRendering)
+	{
+		return;
+	}
+
+	if (m_syncMode == SyncMode::IdleSkipping)
+	{
+		uint32_t skippedCycles = static_cast<uint32_t>(cycle - m_syncedCycle) * MCYCLES_TO_CYCLES;
+		data.m_totalCycles += skippedCycles;
+		data.m_cyclesInMode += skippedCycles;
+	}
+	else if (m_syncMode == SyncMode::CatchUp)
+	{
+		// Same m-cycle steps as if every update had been scheduled, nothing the PPU reads changed without syncing first
+		m_isRendering = true;
+		for (uint64_t i = m_syncedCycle; i < cycle; ++i)
+		{
+			Render(MCYCLES_TO_CYCLES, *m_memory);
+		}
+		m_isRendering = false;
+	}
+	m_syncedCycle = cycle;
+}
+
+void PPU::SetSyncMode(SyncMode mode)
+{
+	m_syncMode = mode;
+	RefreshLCDSync();
+}
+
+void PPU::RefreshLCDSync()
+{
+	m_memory->SetLCDSyncRequired(m_syncMode == SyncMode::CatchUp || m_scanline.m_active);
+}
+
+void PPU::LCDAccess(void* userData, bool isWrite)
+{
+	PPU* ppu = static_cast<PPU*>(userData);
+	ppu->Sync();
+	// Anything written while a scanline is drawn ahead could change its remaining pixels
+	if (isWrite)
+	{
+		ppu->FallBackToFIFO();
+	}
+}
+
+// During HBlank & VBlank nothing but the cycle counters change until the next scanline starts,
+// so those updates are skipped and caught up on later.
+// OAM scan & drawing can't raise an interrupt before HBlank, unless the HBlank STAT interrupt is enabled. Until shortly before the
+// end of the line they only run once something observes the PPU, any access to VRAM, OAM or the LCD registers brings them up to date.
+void PPU::ScheduleNextUpdate(Memory& memory, StateTransition startTransition)
+{
+	SetSyncMode(SyncMode::EveryCycle);
+
+	if (!PPUHelpers::IsControlFlagSet(LCDControlFlags::LCDEnable, memory))
+	{
+		m_scheduler->Deschedule(SchedulerEvent::PPU);
+		return;
+	}
+
+	bool isSettled = startTransition == StateTransition::None
+		&& data.m_stateTransition == StateTransition::None;
+
+	uint32_t cyclesToNextLine = SCANLINE_DURATION - (data.m_totalCycles % SCANLINE_DURATION);
+	uint32_t mCyclesToNextLine = (cyclesToNextLine + MCYCLES_TO_CYCLES - 1) / MCYCLES_TO_CYCLES;
+
+	bool isIdle = (data.m_state == PPUState::HBlank || data.m_state == PPUState::VBlank)
+		&& isSettled
+		&& data.m_cycleDebt == 0
+		&& data.m_lineY == data.m_totalCycles / SCANLINE_DURATION;
+
+	if (isIdle)
+	{
+		if (mCyclesToNextLine > 1)
+		{
+			SetSyncMode(SyncMode::IdleSkipping);
+		}
+		m_scheduler->ScheduleIn(SchedulerEvent::PPU, mCyclesToNextLine);
+		return;
+	}
+
+#if PPU_CATCH_UP
+	bool canCatchUp = (data.m_state == PPUState::OAMScan || data.m_state == PPUState::Drawing)
+		&& isSettled
+		&& !data.m_firstFrame
+		&& !PPUHelpers::IsStatFlagSet(StatFlags::Mode0Interrupt, memory)
+		&& mCyclesToNextLine > CATCH_UP_LINE_END_MARGIN + 1;
+
+	if (canCatchUp)
+	{
+		SetSyncMode(SyncMode::CatchUp);
+		m_scheduler->ScheduleIn(SchedulerEvent::PPU, mCyclesToNextLine - CATCH_UP_LINE_END_MARGIN);
+		return;
+	}
+#endif
+
+	m_scheduler->ScheduleIn(SchedulerEvent::PPU, 1);
 }
 
 void PPU::CheckForInterrupts(Memory& memory)
@@ -281,7 +522,14 @@ void PPU::Render(uint32_t tCycles, Memory& memory)
 					memory.SetVRamWriteAccess(Memory::VRamAccess::VRamOAMBlocked);
 				}
 
-				DrawPixels(memory, processedCycles);
+				if (m_scanline.m_active)
+				{
+					DrawScanlineStep(processedCycles);
+				}
+				else
+				{
+					DrawPixels(memory, processedCycles);
+				}
 
 				if (data.m_lineX == EmulatorConstants::SCREEN_WIDTH)
 				{
@@ -384,14 +632,65 @@ void PPU::Render(uint32_t tCycles, Memory& memory)
 
 void PPU::SwapBackbuffer()
 {
-	RGBA* swap = m_backBuffer;
-	m_backBuffer = m_activeFrame;
-	m_activeFrame = swap;
+	m_completedFrames++;
+
+	// A skipped frame wasn't drawn, the last drawn one stays presented
+	if (!m_isFrameSkipped)
+	{
+		RGBA* swap = m_backBuffer;
+		m_backBuffer = m_activeFrame;
+		m_activeFrame = swap;
+
+		if (!m_isExternalOutput)
+		{
+			m_output.SetBuffer(m_activeFrame);
+		}
+		if (m_frameReadyCallback != nullptr)
+		{
+			m_frameReadyCallback(GetFrameBuffer(), m_frameReadyUserData);
+		}
+	}
+
+	m_isFrameSkipped = m_renderInterval == 0 || m_completedFrames % m_renderInterval != 0;
 }
 
 const void* PPU::GetFrameBuffer() const
 {
-	return m_backBuffer;
+	return m_isExternalOutput ? m_output.GetTarget() : m_backBuffer;
+}
+
+void PPU::SetFrameBuffer(void* buffer, uint32_t stride, EmulatorSettings::PixelFormat format)
+{
+	// Lines the PPU still has to catch up on belong to the previous target
+	Sync();
+
+	if (buffer == nullptr)
+	{
+		m_isExternalOutput = false;
+		m_output.SetTarget(m_activeFrame, EmulatorConstants::SCREEN_WIDTH * sizeof(RGBA), EmulatorSettings::PixelFormat::RGBA8888, SCREEN_COLORS);
+	}
+	else if (m_output.SetTarget(buffer, stride, format, SCREEN_COLORS))
+	{
+		m_isExternalOutput = true;
+	}
+}
+
+void PPU::SetRenderInterval(uint32_t interval)
+{
+	// Turning drawing back on waits for the next frame, so no half drawn frame gets presented
+	m_renderInterval = interval;
+	m_isFrameSkipped |= interval == 0;
+}
+
+void PPU::SetFrameReadyCallback(Emulator::FrameReadyCallback callback, void* userData)
+{
+	m_frameReadyCallback = callback;
+	m_frameReadyUserData = userData;
+}
+
+uint64_t PPU::GetCompletedFrames() const
+{
+	return m_completedFrames;
 }
 
 void PPU::TransitionToVBlank(Memory& memory, uint32_t processedCycles)
@@ -408,6 +707,10 @@ void PPU::TransitionToHBlank(Memory& memory, uint32_t processedCycles)
 		data.m_windowLineY++;
 	}
 	data.m_firstFrame = false;
+	if (!m_isFrameSkipped)
+	{
+		m_output.WriteLine(data.m_lineY, m_lineShades);
+	}
 
 	data.m_state = PPUState::HBlank;
 	data.m_stateTransition = StateTransition::Cycle0;
@@ -416,15 +719,18 @@ void PPU::TransitionToHBlank(Memory& memory, uint32_t processedCycles)
 
 void PPU::TransitionToDraw(Memory& memory, uint32_t processedCycles)
 {
-	data.m_lineX = 0;
-	data.m_backgroundFIFO.Clear();
-	data.m_spriteFIFO.Clear();
-	data.m_backgroundFetcher.Reset();
-	data.m_spriteFetcher.Reset();
+	AddScannedSprites(OAM_ENTRY_COUNT);
+	ResetDrawing();
 
 	data.m_state = PPUState::Drawing;
 	data.m_stateTransition = StateTransition::Cycle0;
 	data.m_cyclesInMode = -static_cast<int32_t>(processedCycles);
+
+	// Skipped frames only need the timing, which the scanline renderer gets without going through the FIFO
+	if ((m_accuracy == EmulatorSettings::PPUAccuracy::Scanline || m_isFrameSkipped) && !data.m_firstFrame)
+	{
+		DrawScanline(memory);
+	}
 }
 
 void PPU::TransitionToOAMScan(Memory& memory, uint32_t processedCycles)
@@ -433,6 +739,7 @@ void PPU::TransitionToOAMScan(Memory& memory, uint32_t processedCycles)
 	data.m_lineSpriteCount = 0;
 	data.m_lineSpriteMask = 0;
 	data.m_spritePrefetchLine = 0;
+	m_oamScan.m_isValid = false;
 	data.m_windowState = PPUHelpers::IsControlFlagSet(LCDControlFlags::WindowEnable, memory) && data.m_lineY >= memory.ReadIO(WY_REGISTER) ? WindowState::InScanline : WindowState::NoWindow;
 	
 	data.m_state = PPUState::OAMScan;
@@ -453,11 +760,27 @@ void PPU::DisableScreen(Memory& memory)
 	data.m_windowLineY = 0;
 	data.m_state = PPUState::HBlank;
 	PPUHelpers::SetModeFlag(static_cast<uint8_t>(PPUState::HBlank), memory);
-	memset_y(m_activeFrame, 1, sizeof(RGBA) * EmulatorConstants::SCREEN_SIZE);
+	if (m_isExternalOutput)
+	{
+		m_output.Clear(0);
+	}
+	else
+	{
+		memset_y(m_activeFrame, 1, sizeof(RGBA) * EmulatorConstants::SCREEN_SIZE);
+	}
 	memory.SetVRamReadAccess(Memory::VRamAccess::All);
 	memory.SetVRamWriteAccess(Memory::VRamAccess::All);
 }
 
+void PPU::ResetDrawing()
+{
+	data.m_lineX = 0;
+	data.m_backgroundFIFO.Clear();
+	data.m_spriteFIFO.Clear();
+	data.m_backgroundFetcher.Reset();
+	data.m_spriteFetcher.Reset();
+}
+
 void PPU::DrawPixels(Memory& memory, uint32_t& processedCycles)
 {
 	processedCycles += 2;
@@ -535,63 +858,408 @@ void PPU::RenderNextPixel(Memory& memory)
 {
 	Pixel bgPixel = data.m_backgroundFIFO.Pop();
 
-	RGBA pixelColor = data.m_cachedBackgroundColors[bgPixel.m_color];
+	if (m_isFrameSkipped)
+	{
+		if (data.m_spriteFIFO.Size() > 0)
+		{
+			data.m_spriteFIFO.Pop();
+		}
+		data.m_lineX++;
+		return;
+	}
+
+	uint8_t pixelShade = m_backgroundShades[bgPixel.m_color];
 
 	if (!data.m_cachedBackgroundEnabled && data.m_windowState != WindowState::Draw)
 	{
-		pixelColor = SCREEN_COLORS[0];
+		pixelShade = 0;
 	}
 
 	if (data.m_spriteFIFO.Size() > 0)
 	{
 		Pixel spritePixel = data.m_spriteFIFO.Pop();
-		RGBA spritePixelColor = PPUHelpers::ResolvePixelColor(spritePixel.m_color, spritePixel.m_palette == 0 ? OBJ0_REGISTER : OBJ1_REGISTER, memory);
+		uint8_t spritePixelShade = PPUHelpers::ResolvePixelShade(spritePixel.m_color, spritePixel.m_palette == 0 ? OBJ0_REGISTER : OBJ1_REGISTER, memory);
 
 		if (PPUHelpers::IsControlFlagSet(LCDControlFlags::ObjEnable, memory) && 
-			(spritePixel.m_color != 0 && (!spritePixel.m_backgroundPriority || pixelColor == SCREEN_COLORS[0])))
+			(spritePixel.m_color != 0 && (!spritePixel.m_backgroundPriority || pixelShade == 0)))
 		{
-			pixelColor = spritePixelColor;
+			pixelShade = spritePixelShade;
 		}
 	}
 
-	uint32_t renderIndex = data.m_lineX + data.m_lineY * EmulatorConstants::SCREEN_WIDTH;
-	m_activeFrame[renderIndex] = pixelColor;
+	m_lineShades[data.m_lineX] = pixelShade;
 	data.m_lineX++;
 }
 
 void PPU::ScanOAM(uint32_t positionInLine, Memory& memory)
 {
-	uint8_t oamEntry = (positionInLine / 2);
-
-	SpriteAttributes attr = memory.ReadOAMEntry(oamEntry);
+	uint8_t oamEntry = static_cast<uint8_t>(positionInLine / 2);
 	bool doubleSize = PPUHelpers::IsControlFlagSet(LCDControlFlags::ObjSize, memory);
-	uint8_t doubleSizeAdjustment = doubleSize ? 0 : SPRITE_SINGLE_SIZE;
 
-	bool isInLine = data.m_lineY + doubleSizeAdjustment < attr.m_posY && data.m_lineY + SPRITE_DOUBLE_SIZE >= attr.m_posY;
+	// If OAM or the sprite size changed since the last evaluation, the entries scanned up to now still saw the previous values
+	if (!m_oamScan.m_isValid || m_oamScan.m_oamGeneration != memory.GetOAMGeneration() || m_oamScan.m_doubleSize != doubleSize)
+	{
+		AddScannedSprites(oamEntry);
+		EvaluateOAM(oamEntry, doubleSize, memory);
+	}
+	m_oamScan.m_scannedEntries = oamEntry + 1;
+}
+
+void PPU::EvaluateOAM(uint8_t firstEntry, bool doubleSize, Memory& memory)
+{
+	m_oamScan.m_isValid = true;
+	m_oamScan.m_doubleSize = doubleSize;
+	m_oamScan.m_oamGeneration = memory.GetOAMGeneration();
+	m_oamScan.m_spriteCount = 0;
+	m_oamScan.m_nextSprite = 0;
+
+	uint8_t freeSlots = MAX_SPRITES_PER_LINE - data.m_lineSpriteCount;
+	uint64_t sprites = OAMScan::FindSpritesInLine(memory.GetOAM(), data.m_lineY, doubleSize) >> firstEntry;
+	for (uint8_t entry = firstEntry; sprites != 0 && m_oamScan.m_spriteCount < freeSlots; ++entry, sprites >>= 1)
+	{
+		if ((sprites & 1) != 0)
+		{
+			m_oamScan.m_entries[m_oamScan.m_spriteCount] = entry;
+			m_oamScan.m_sprites[m_oamScan.m_spriteCount] = memory.ReadOAMEntry(entry);
+			m_oamScan.m_spriteCount++;
+		}
+	}
+}
+
+// Adds the sprites of the evaluation the scan went past, up to but excluding endEntry
+void PPU::AddScannedSprites(uint8_t endEntry)
+{
+	if (!m_oamScan.m_isValid)
+	{
+		return;
+	}
 
-	if (data.m_lineSpriteCount < MAX_SPRITES_PER_LINE && isInLine)
+	uint8_t prevCount = data.m_lineSpriteCount;
+	while (m_oamScan.m_nextSprite < m_oamScan.m_spriteCount && m_oamScan.m_entries[m_oamScan.m_nextSprite] < endEntry)
 	{
-		data.m_lineSprites[data.m_lineSpriteCount] = attr;
+		data.m_lineSprites[data.m_lineSpriteCount] = m_oamScan.m_sprites[m_oamScan.m_nextSprite];
 		data.m_lineSpriteCount++;
+		m_oamScan.m_nextSprite++;
+	}
+
+	if (data.m_lineSpriteCount != prevCount)
+	{
+		SortLineSprites();
+	}
+}
+
+void PPU::SortLineSprites()
+{
+	for (uint8_t i = 0; i < data.m_lineSpriteCount; ++i)
+	{
+		uint8_t position = i;
+		while (position > 0 && data.m_lineSprites[m_lineSpriteOrder[position - 1]].m_posX > data.m_lineSprites[i].m_posX)
+		{
+			m_lineSpriteOrder[position] = m_lineSpriteOrder[position - 1];
+			position--;
+		}
+		m_lineSpriteOrder[position] = i;
 	}
 }
 
 bool PPU::GetCurrentSprite(uint8_t& spriteIndex, uint8_t offset) const
 {
-	bool foundSprite = false;
-	int16_t minDifference = SCANLINE_DURATION;
+	return FindSprite(spriteIndex, data.m_lineX, data.m_lineSpriteMask, offset);
+}
+
+// The first sprite not fetched yet at or right after the position, going by x position the closest one is also the first in OAM order
+bool PPU::FindSprite(uint8_t& spriteIndex, uint8_t lineX, uint16_t spriteMask, uint8_t offset) const
+{
+	int16_t position = lineX + offset;
 	for (uint8_t i = 0; i < data.m_lineSpriteCount; ++i)
 	{
-		int16_t posDifference = data.m_lineSprites[i].m_posX - (data.m_lineX + offset);
-		bool isAvailable = (data.m_lineSpriteMask & (1 << i)) == 0;
-		if (isAvailable && (posDifference == 0 || posDifference == 1) && abs_y(posDifference) < minDifference)
+		uint8_t sprite = m_lineSpriteOrder[i];
+		int16_t posDifference = data.m_lineSprites[sprite].m_posX - position;
+		if ((spriteMask & (1 << sprite)) != 0 || posDifference < 0)
+		{
+			continue;
+		}
+
+		if (posDifference <= 1)
+		{
+			spriteIndex = sprite;
+			return true;
+		}
+		return false;
+	}
+	return false;
+}
+
+// Draws the whole line at the start of mode 3. The fetchers & FIFOs are only simulated by their fill levels, which gives
+// the amount of DrawPixels steps mode 3 takes as well as the x positions at which the window & each sprite were fetched.
+// As long as nothing the line depends on is written, the pixels are the same as those of the pixel FIFO.
+void PPU::DrawScanline(Memory& memory)
+{
+	Scanline& line = m_scanline;
+	line.m_startWindowState = data.m_windowState;
+	line.m_startFineScrollX = data.m_fineScrollX;
+	line.m_step = 0;
+	line.m_spriteFetchCount = 0;
+	line.m_nextSpriteFetch = 0;
+
+	uint8_t windowX = memory.ReadIO(WX_REGISTER);
+	WindowState windowState = data.m_windowState;
+	uint8_t fineScrollX = data.m_fineScrollX;
+	uint8_t windowStartX = EmulatorConstants::SCREEN_WIDTH;
+	uint8_t windowFineScrollX = 0;
+
+	uint8_t lineX = 0;
+	uint8_t step = 0;
+	uint8_t backgroundFIFOSize = 0;
+	uint8_t backgroundFetchStep = 0;
+	uint8_t spriteFetchStep = 0;
+	uint8_t spritePrefetchLine = 0;
+	uint16_t spriteMask = 0;
+
+	uint8_t fetchedSprites[MAX_SPRITES_PER_LINE];
+	uint8_t fetchedSpriteX[MAX_SPRITES_PER_LINE];
+	uint8_t fetchedSpriteCount = 0;
+
+	while (lineX < EmulatorConstants::SCREEN_WIDTH)
+	{
+		uint8_t currentStep = step++;
+
+		if (windowState == WindowState::InScanline && lineX + 7 >= windowX)
+		{
+			backgroundFIFOSize = 0;
+			backgroundFetchStep = 0;
+			windowState = WindowState::Draw;
+			fineScrollX = (0x7 - windowX) & 0x7;
+			windowStartX = lineX;
+			windowFineScrollX = lineX == 0 ? fineScrollX : 0;
+		}
+
+		uint8_t spriteIndex;
+		bool foundSprite = false;
+		if (lineX == 0)
+		{
+			while (spritePrefetchLine < SPRITE_SINGLE_SIZE && !foundSprite)
+			{
+				foundSprite = FindSprite(spriteIndex, lineX, spriteMask, SPRITE_SINGLE_SIZE - spritePrefetchLine);
+				if (!foundSprite)
+				{
+					spritePrefetchLine++;
+				}
+			}
+		}
+
+		if (foundSprite || FindSprite(spriteIndex, lineX, spriteMask, SPRITE_SINGLE_SIZE))
+		{
+			// GetTile, ReadTileLow, ReadTileHigh & pushing the pixels in Sleep
+			if (spriteFetchStep == 0)
+			{
+				line.m_spriteFetchSteps[line.m_spriteFetchCount++] = currentStep;
+			}
+			if (spriteFetchStep == 3)
+			{
+				spriteMask |= (1 << spriteIndex);
+				fetchedSprites[fetchedSpriteCount] = spriteIndex;
+				fetchedSpriteX[fetchedSpriteCount] = lineX;
+				fetchedSpriteCount++;
+				spriteFetchStep = 0;
+			}
+			else
+			{
+				spriteFetchStep++;
+			}
+			continue;
+		}
+
+		if (backgroundFetchStep < 2)
+		{
+			backgroundFetchStep++;
+		}
+		else if ((backgroundFetchStep == 2 && backgroundFIFOSize < TILE_SIZE) || (backgroundFetchStep == 3 && backgroundFIFOSize <= TILE_SIZE))
+		{
+			backgroundFIFOSize += TILE_SIZE;
+			backgroundFetchStep = 0;
+		}
+		else
+		{
+			backgroundFetchStep = 3;
+		}
+
+		if (lineX == 0 && fineScrollX > 0 && backgroundFIFOSize > SPRITE_SINGLE_SIZE)
+		{
+			for (uint8_t i = 0; i < 2; ++i)
+			{
+				backgroundFIFOSize--;
+				fineScrollX--;
+				if (fineScrollX == 0)
+				{
+					break;
+				}
+			}
+			continue;
+		}
+
+		if (backgroundFIFOSize > SPRITE_SINGLE_SIZE)
+		{
+			backgroundFIFOSize -= 2;
+			lineX += 2;
+		}
+	}
+
+	line.m_stepCount = step;
+	line.m_endWindowState = windowState;
+	line.m_endFineScrollX = fineScrollX;
+	line.m_endSpriteMask = spriteMask;
+	line.m_endSpritePrefetchLine = spritePrefetchLine;
+
+	if (m_isFrameSkipped)
+	{
+		line.m_active = true;
+		RefreshLCDSync();
+		return;
+	}
+
+	uint8_t lcdc = memory.ReadIO(LCDC_REGISTER);
+	bool isUnsignedAddressing = (lcdc & (1 << static_cast<uint8_t>(LCDControlFlags::BgTileDataArea))) > 0;
+	uint8_t* lineShades = m_lineShades;
+
+	uint8_t backgroundY = memory.ReadIO(SCY_REGISTER) + data.m_lineY;
+	uint16_t backgroundMap = (lcdc & (1 << static_cast<uint8_t>(LCDControlFlags::BgTileMapArea))) > 0 ? TILE_MAP_2 : TILE_MAP_1;
+	const uint8_t* backgroundShades = data.m_cachedBackgroundEnabled ? m_backgroundShades : DISABLED_BACKGROUND_SHADES;
+	PPUHelpers::DrawTileRow(lineShades, 0, windowStartX, data.m_fineScrollX, backgroundMap + (backgroundY / TILE_SIZE) * TILE_MAP_DIMENSIONS,
+		memory.ReadIO(SCX_REGISTER) / TILE_SIZE, true, backgroundY % TILE_SIZE, isUnsignedAddressing, backgroundShades, memory);
+
+	if (windowStartX < EmulatorConstants::SCREEN_WIDTH)
+	{
+		uint16_t windowMap = (lcdc & (1 << static_cast<uint8_t>(LCDControlFlags::WindowTileMapArea))) > 0 ? TILE_MAP_2 : TILE_MAP_1;
+		PPUHelpers::DrawTileRow(lineShades, windowStartX, EmulatorConstants::SCREEN_WIDTH, windowFineScrollX, windowMap + (data.m_windowLineY / TILE_SIZE) * TILE_MAP_DIMENSIONS,
+			0, false, data.m_windowLineY % TILE_SIZE, isUnsignedAddressing, m_backgroundShades, memory);
+	}
+
+	if (fetchedSpriteCount == 0)
+	{
+		line.m_active = true;
+		RefreshLCDSync();
+		return;
+	}
+
+	// Sprite pixels at the screen position they are popped from the sprite FIFO, which keeps pace with the drawn pixels
+	Pixel spritePixels[SCANLINE_SPRITE_BUFFER_SIZE];
+	memset_y(spritePixels, 0, sizeof(spritePixels));
+	uint8_t spriteFIFOEnd = 0;
+
+	bool doubleSize = (lcdc & (1 << static_cast<uint8_t>(LCDControlFlags::ObjSize))) > 0;
+	for (uint8_t i = 0; i < fetchedSpriteCount; ++i)
+	{
+		const SpriteAttributes& sprite = data.m_lineSprites[fetchedSprites[i]];
+		uint8_t currentX = fetchedSpriteX[i];
+
+		uint8_t yOffset = data.m_lineY + SPRITE_DOUBLE_SIZE - sprite.m_posY;
+		if ((sprite.m_flags & (1 << SPRITE_FLAG_Y_FLIP)) > 0)
+		{
+			yOffset = (doubleSize ? SPRITE_DOUBLE_SIZE : SPRITE_SINGLE_SIZE) - 1 - yOffset;
+		}
+		uint16_t tileIndex = doubleSize ? sprite.m_tileIndex & ~1 : sprite.m_tileIndex;
+		uint16_t tileAddr = TILE_DATA_BLOCK_1 + tileIndex * TILE_BYTE_SIZE + yOffset * 2;
+		const uint8_t* tileRow = memory.GetTileRow(tileAddr);
+
+		// Same placement as PixelFetcher::PushPixels, relative to the head of the sprite FIFO
+		uint8_t fifoSize = spriteFIFOEnd > currentX ? spriteFIFOEnd - currentX : 0;
+		bool isOddPosition = sprite.m_posX != currentX + TILE_SIZE;
+		uint8_t start = static_cast<uint8_t>(y::max(0, TILE_SIZE - static_cast<int16_t>(sprite.m_posX)));
+		if (isOddPosition && start == 0)
+		{
+			spritePixels[currentX + fifoSize] = Pixel{ 0x00, 0, false };
+			fifoSize++;
+		}
+
+		bool flip = (sprite.m_flags & (1 << SPRITE_FLAG_X_FLIP)) > 0;
+		Pixel pixel{ 0x00, static_cast<uint8_t>((sprite.m_flags >> SPRITE_FLAG_PALETTE) & 0x1), (sprite.m_flags & (1 << SPRITE_FLAG_BG_PRIORITY)) > 0 };
+		for (uint8_t j = start; j < TILE_SIZE; ++j)
+		{
+			pixel.m_color = tileRow[flip ? TILE_SIZE - 1 - j : j];
+			uint8_t fifoIndex = static_cast<uint8_t>(y::max(0, (isOddPosition ? j + 1 : j) - start));
+			if (fifoSize > fifoIndex)
+			{
+				if (spritePixels[currentX + fifoIndex].m_color == 0x00)
+				{
+					spritePixels[currentX + fifoIndex] = pixel;
+				}
+			}
+			else
+			{
+				spritePixels[currentX + fifoSize] = pixel;
+				fifoSize++;
+			}
+		}
+		spriteFIFOEnd = currentX + fifoSize;
+	}
+
+	if (PPUHelpers::IsControlFlagSet(LCDControlFlags::ObjEnable, memory))
+	{
+		uint8_t spritePalettes[2] = { memory[OBJ0_REGISTER], memory[OBJ1_REGISTER] };
+		for (uint32_t x = 0; x < spriteFIFOEnd && x < EmulatorConstants::SCREEN_WIDTH; ++x)
 		{
-			minDifference = abs_y(posDifference);
-			spriteIndex = i;
-			foundSprite = true;
+			const Pixel& spritePixel = spritePixels[x];
+			if (spritePixel.m_color != 0 && (!spritePixel.m_backgroundPriority || lineShades[x] == 0))
+			{
+				lineShades[x] = (spritePalettes[spritePixel.m_palette] >> (spritePixel.m_color * 2)) & 0x3;
+			}
 		}
 	}
-	return foundSprite;
+
+	line.m_active = true;
+	RefreshLCDSync();
+}
+
+// One DrawPixels step of a scanline that is already drawn
+void PPU::DrawScanlineStep(uint32_t& processedCycles)
+{
+	Scanline& line = m_scanline;
+	processedCycles += 2;
+	if (line.m_nextSpriteFetch < line.m_spriteFetchCount && line.m_spriteFetchSteps[line.m_nextSpriteFetch] == line.m_step)
+	{
+		processedCycles += 2;
+		line.m_nextSpriteFetch++;
+	}
+
+	line.m_step++;
+	if (line.m_step == line.m_stepCount)
+	{
+		data.m_lineX = EmulatorConstants::SCREEN_WIDTH;
+		data.m_windowState = line.m_endWindowState;
+		data.m_fineScrollX = line.m_endFineScrollX;
+		data.m_lineSpriteMask = line.m_endSpriteMask;
+		data.m_spritePrefetchLine = line.m_endSpritePrefetchLine;
+		line.m_active = false;
+		RefreshLCDSync();
+	}
+}
+
+// Replays the steps of the scanline taken so far through the pixel FIFO, so drawing can continue from there with exact timing
+void PPU::FallBackToFIFO()
+{
+	if (!m_scanline.m_active)
+	{
+		return;
+	}
+
+	m_scanline.m_active = false;
+	RefreshLCDSync();
+
+	ResetDrawing();
+	data.m_windowState = m_scanline.m_startWindowState;
+	data.m_fineScrollX = m_scanline.m_startFineScrollX;
+	data.m_lineSpriteMask = 0;
+	data.m_spritePrefetchLine = 0;
+
+	bool wasRendering = m_isRendering;
+	m_isRendering = true;
+	uint32_t processedCycles = 0;
+	for (uint8_t i = 0; i < m_scanline.m_step; ++i)
+	{
+		DrawPixels(*m_memory, processedCycles);
+	}
+	m_isRendering = wasRendering;
 }
 
 void PPU::CacheBackgroundPalette(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
@@ -601,12 +1269,16 @@ void PPU::CacheBackgroundPalette(Memory* memory, uint16_t addr, uint8_t prevValu
 	{
 		uint32_t colorIndex = (newValue >> (i * 2)) & 0x3;
 		ppu->data.m_cachedBackgroundColors[i] = SCREEN_COLORS[colorIndex];
+		ppu->m_backgroundShades[i] = static_cast<uint8_t>(colorIndex);
 	}
 }
 
 void PPU::LCDCWrite(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
 {
 	PPU* ppu = static_cast<PPU*>(userData);
+	ppu->Sync();
+	ppu->m_scheduler->ScheduleIn(SchedulerEvent::PPU, 1);
+
 	ppu->data.m_cachedBackgroundEnabled = (newValue & (1 << static_cast<uint8_t>(LCDControlFlags::BgEnable))) > 0;
 
 	bool PPUPowerPrev = (prevValue & (1 << static_cast<uint8_t>(LCDControlFlags::LCDEnable))) > 0;
@@ -625,8 +1297,24 @@ void PPU::LCDCWrite(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t ne
 	}
 }
 
+void PPU::StatusRegisterWrite(Memory*, uint16_t, uint8_t, uint8_t, void* userData)
+{
+	PPU* ppu = static_cast<PPU*>(userData);
+	if (!ppu->m_isRendering)
+	{
+		ppu->Sync();
+		ppu->m_scheduler->ScheduleIn(SchedulerEvent::PPU, 1);
+	}
+}
+
 void PPU::Serialize(uint8_t* sData)
 {
+	FallBackToFIFO();
+	if (data.m_state == PPUState::OAMScan)
+	{
+		AddScannedSprites(m_oamScan.m_scannedEntries);
+	}
+
 	uint32_t dataSize = sizeof(data);
 	WriteAndMove(sData, &data, dataSize);
 }
@@ -634,6 +1322,21 @@ void PPU::Serialize(uint8_t* sData)
 void PPU::Deserialize(const uint8_t* sData)
 {
 	ReadAndMove(sData, &data, sizeof(data));
+	m_scanline.m_active = false;
+	m_oamScan.m_isValid = false;
+	SortLineSprites();
+
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		m_backgroundShades[i] = 0;
+		for (uint8_t shade = 0; shade < 4; ++shade)
+		{
+			if (data.m_cachedBackgroundColors[i] == SCREEN_COLORS[shade])
+			{
+				m_backgroundShades[i] = shade;
+			}
+		}
+	}
 }
 
 uint32_t PPU::GetSerializationSize()
@@ -674,6 +1377,11 @@ Emulator::FIFOSizes PPU::GetFIFOSizes() const
 
 Emulator::PPUState PPU::GetPPUState()
 {
+	Sync();
+	if (data.m_state == PPUState::OAMScan)
+	{
+		AddScannedSprites(m_oamScan.m_scannedEntries);
+	}
 	return Emulator::PPUState
 	{
 		static_cast<uint8_t>(data.m_state),
@@ -3,28 +3,23 @@
 #include "PixelFIFO.h"
 #include "../Include/Emulator.h"
 #include "PixelFetcher.h"
+#include "Scheduler.h"
+#include "FrameOutput.h"
+#include "OAMScan.h"
 
 #define MAX_SPRITES_PER_LINE 10
 
-typedef void (*RenderFunc)(const void* image);
-
-struct RGBA
-{
-	uint8_t r;
-	uint8_t g;
-	uint8_t b;
-	uint8_t a;
+// 1 lets the PPU fall behind during OAM scan & drawing and catch up once its state is observed, 0 updates it every m-cycle
+#ifndef PPU_CATCH_UP
+#define PPU_CATCH_UP 1
+#endif
 
-	bool operator==(const RGBA& other)
-	{
-		return r == other.r && g == other.g && b == other.b && a == other.a;
-	}
-};
+typedef void (*RenderFunc)(const void* image);
 
 class PPU : ISerializable
 {
 public:
-	PPU(GamestateSerializer* serializer);
+	PPU(Allocator* allocator, GamestateSerializer* serializer, Scheduler* scheduler);
 
 	~PPU() override;
 
@@ -32,9 +27,19 @@ public:
 	PPU operator= (const PPU& other) = delete;
 
 	void Init(Memory& memory);
+	void Update(uint32_t tCycles, Memory& memory);
 	void Render(uint32_t mCycles, Memory& memory);
+	void Sync();
+	void SyncToPreviousCycle();
+	void ResetSync();
+	bool IsCatchingUp() const;
+	void SetAccuracy(EmulatorSettings::PPUAccuracy accuracy);
 	void SwapBackbuffer();
 	const void* GetFrameBuffer() const;
+	void SetFrameBuffer(void* buffer, uint32_t stride, EmulatorSettings::PixelFormat format);
+	void SetFrameReadyCallback(Emulator::FrameReadyCallback callback, void* userData);
+	void SetRenderInterval(uint32_t interval);
+	uint64_t GetCompletedFrames() const;
 
 #if defined(_DEBUG)
 	Emulator::FIFOSizes GetFIFOSizes() const;
@@ -58,6 +63,14 @@ private:
 		Draw = 2
 	};
 
+	// How the PPU gets from its last update to the current cycle
+	enum class SyncMode
+	{
+		EveryCycle = 0,
+		IdleSkipping = 1, // Only the cycle counters advance
+		CatchUp = 2, // Rendered in bulk once the state is observed
+	};
+
 	enum class StateTransition
 	{
 		None = 0,
@@ -67,6 +80,9 @@ private:
 	};
 
 	void ScanOAM(uint32_t positionInLine, Memory& memory);
+	void EvaluateOAM(uint8_t firstEntry, bool doubleSize, Memory& memory);
+	void AddScannedSprites(uint8_t endEntry);
+	void SortLineSprites();
 	void RenderNextPixel(Memory& memory);
 
 	void TransitionToVBlank(Memory& memory, uint32_t processedCycles);
@@ -75,13 +91,61 @@ private:
 	void TransitionToOAMScan(Memory& memory, uint32_t processedCycles);
 
 	void DisableScreen(Memory& memory);
+	void ResetDrawing();
 	void DrawPixels(Memory& memory, uint32_t& processedCycles);
 	void CheckForInterrupts(Memory& memory);
 
 	bool GetCurrentSprite(uint8_t& spriteIndex, uint8_t offset) const;
+	bool FindSprite(uint8_t& spriteIndex, uint8_t lineX, uint16_t spriteMask, uint8_t offset) const;
+
+	void DrawScanline(Memory& memory);
+	void DrawScanlineStep(uint32_t& processedCycles);
+	void FallBackToFIFO();
+
+	void CatchUp(uint64_t cycle);
+	void ScheduleNextUpdate(Memory& memory, StateTransition startTransition);
+	void SetSyncMode(SyncMode mode);
+	void RefreshLCDSync();
+
+	static void LCDAccess(void* userData, bool isWrite);
 
 	static void CacheBackgroundPalette(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
 	static void LCDCWrite(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
+	static void StatusRegisterWrite(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
+
+	// A scanline drawn ahead of time, mode 3 then only steps through the m-cycles the pixel FIFO would have taken
+	struct Scanline
+	{
+		bool m_active;
+		uint8_t m_step;
+		uint8_t m_stepCount;
+		uint8_t m_spriteFetchCount;
+		uint8_t m_nextSpriteFetch;
+		// Steps in which a sprite fetch starts, they take 2 extra dots
+		uint8_t m_spriteFetchSteps[MAX_SPRITES_PER_LINE];
+
+		// Drawing state at the start & end of mode 3
+		WindowState m_startWindowState;
+		uint8_t m_startFineScrollX;
+		WindowState m_endWindowState;
+		uint8_t m_endFineScrollX;
+		uint16_t m_endSpriteMask;
+		uint8_t m_endSpritePrefetchLine;
+	};
+
+	// All of OAM evaluated in one go at the start of the scan. The sprites found are only added to the line sprites once the scan
+	// reaches their entry, as long as OAM & the sprite size stay the same that gives exactly what scanning one entry at a time would.
+	struct OAMScanResult
+	{
+		bool m_isValid;
+		bool m_doubleSize;
+		uint32_t m_oamGeneration;
+		uint8_t m_scannedEntries;
+		uint8_t m_spriteCount;
+		uint8_t m_nextSprite;
+		uint8_t m_entries[MAX_SPRITES_PER_LINE];
+		SpriteAttributes m_sprites[MAX_SPRITES_PER_LINE];
+	};
 
 	struct TrackedBool
 	{
@@ -155,9 +219,35 @@ private:
 
 		bool m_firstFrame;
 	} data;
+	Allocator* m_allocator;
+	Scheduler* m_scheduler;
+	Memory* m_memory;
 	RGBA* m_activeFrame;
 	RGBA* m_backBuffer;
 
+	// The line being drawn as shades, written to the frame buffer once it is finished
+	uint8_t m_lineShades[EmulatorConstants::SCREEN_WIDTH];
+	uint8_t m_backgroundShades[4];
+	FrameOutput m_output;
+	bool m_isExternalOutput;
+	Emulator::FrameReadyCallback m_frameReadyCallback;
+	void* m_frameReadyUserData;
+
+	// Frames in between rendered ones keep their timing but aren't drawn
+	uint32_t m_renderInterval;
+	bool m_isFrameSkipped;
+
+	uint64_t m_syncedCycle;
+	uint64_t m_completedFrames;
+	SyncMode m_syncMode;
+	bool m_isRendering;
+
+	EmulatorSettings::PPUAccuracy m_accuracy;
+	Scanline m_scanline;
+	OAMScanResult m_oamScan;
+	// Indices of the line sprites sorted by their x position, in OAM order for the same position
+	uint8_t m_lineSpriteOrder[MAX_SPRITES_PER_LINE];
+
 
 	// Inherited via ISerializable
 	void Serialize(uint8_t* data) override;
@@ -1,6 +1,101 @@
 #pragma once
 #include "CppIncludes.h"
 
+#define PIXEL_FIFO_CAPACITY 16
+#define PIXEL_FIFO_ROW_SIZE 8
+
+// 1 keeps the pixel FIFOs as bitplane shift registers, 0 as a ring buffer of single pixels
+#ifndef PIXEL_FIFO_BITPLANES
+#define PIXEL_FIFO_BITPLANES 1
+#endif
+
+struct Pixel
+{
+	uint8_t m_color;
+	uint8_t m_palette;
+	bool m_backgroundPriority;
+};
+
+#if PIXEL_FIFO_BITPLANES
+
+// Every pixel attribute is a 16 bit shift register, the most significant bit being the head of the FIFO.
+// Bits past the size are always 0.
+class PixelFIFO
+{
+public:
+	PixelFIFO()
+	{
+		Clear();
+	}
+
+	// Appends a tile row, bit 7 of the tile data being its leftmost pixel. Pixels that don't fit are dropped
+	void PushRow(uint8_t low, uint8_t high)
+	{
+		m_low |= static_cast<uint16_t>(low << PIXEL_FIFO_ROW_SIZE) >> m_size;
+		m_high |= static_cast<uint16_t>(high << PIXEL_FIFO_ROW_SIZE) >> m_size;
+		m_size = m_size + PIXEL_FIFO_ROW_SIZE < PIXEL_FIFO_CAPACITY ? m_size + PIXEL_FIFO_ROW_SIZE : PIXEL_FIFO_CAPACITY;
+	}
+
+	void PushTransparent()
+	{
+		if (m_size < PIXEL_FIFO_CAPACITY)
+		{
+			m_size++;
+		}
+	}
+
+	// Places the leftmost count pixels of a tile row from the given index on. Pixels in the FIFO are only replaced if they are transparent,
+	// the rest get appended, if the index is past the end they are appended right away
+	void MergeRow(uint8_t index, uint8_t low, uint8_t high, uint8_t count, bool palette, bool backgroundPriority)
+	{
+		uint32_t start = index < m_size ? index : m_size;
+		uint16_t rowMask = static_cast<uint16_t>(0xFFFF << (PIXEL_FIFO_CAPACITY - count)) >> start;
+		uint16_t writeMask = rowMask & ~(m_low | m_high);
+
+		m_low = (m_low & ~writeMask) | ((static_cast<uint16_t>(low << PIXEL_FIFO_ROW_SIZE) >> start) & writeMask);
+		m_high = (m_high & ~writeMask) | ((static_cast<uint16_t>(high << PIXEL_FIFO_ROW_SIZE) >> start) & writeMask);
+		m_palette = (m_palette & ~writeMask) | (palette ? writeMask : 0);
+		m_priority = (m_priority & ~writeMask) | (backgroundPriority ? writeMask : 0);
+
+		uint32_t end = start + count < PIXEL_FIFO_CAPACITY ? start + count : PIXEL_FIFO_CAPACITY;
+		m_size = end > m_size ? end : m_size;
+	}
+
+	Pixel Pop()
+	{
+		Pixel pixel{ static_cast<uint8_t>(((m_high >> 14) & 0x2) | (m_low >> 15)), static_cast<uint8_t>(m_palette >> 15), (m_priority >> 15) > 0 };
+		m_low <<= 1;
+		m_high <<= 1;
+		m_palette <<= 1;
+		m_priority <<= 1;
+		m_size--;
+		return pixel;
+	}
+
+	void Clear()
+	{
+		m_low = 0;
+		m_high = 0;
+		m_palette = 0;
+		m_priority = 0;
+		m_size = 0;
+	}
+
+	uint32_t Size() const
+	{
+		return m_size;
+	}
+
+private:
+	uint16_t m_low;
+	uint16_t m_high;
+	uint16_t m_palette;
+	uint16_t m_priority;
+	uint32_t m_size;
+};
+
+#else
+
 template <typename T, uint32_t CAPACITY>
 class StaticFIFO
 {
@@ -58,11 +153,42 @@ private:
 	uint32_t m_index;
 };
 
-struct Pixel
+class PixelFIFO : public StaticFIFO<Pixel, PIXEL_FIFO_CAPACITY>
 {
-	uint8_t m_color;
-	uint8_t m_palette;
-	bool m_backgroundPriority;
+public:
+	void PushRow(uint8_t low, uint8_t high)
+	{
+		for (uint32_t i = 0; i < PIXEL_FIFO_ROW_SIZE; ++i)
+		{
+			uint32_t bit = PIXEL_FIFO_ROW_SIZE - 1 - i;
+			Push(Pixel{ static_cast<uint8_t>((((high >> bit) & 0x1) << 1) | ((low >> bit) & 0x1)), 0, false });
+		}
+	}
+
+	void PushTransparent()
+	{
+		Push(Pixel{ 0x00, 0, false });
+	}
+
+	void MergeRow(uint8_t index, uint8_t low, uint8_t high, uint8_t count, bool palette, bool backgroundPriority)
+	{
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			uint32_t bit = PIXEL_FIFO_ROW_SIZE - 1 - i;
+			Pixel pixel{ static_cast<uint8_t>((((high >> bit) & 0x1) << 1) | ((low >> bit) & 0x1)), palette, backgroundPriority };
+			if (Size() > index + i)
+			{
+				if (Get(index + i).m_color == 0x00)
+				{
+					Replace(index + i, pixel);
+				}
+			}
+			else
+			{
+				Push(pixel);
+			}
+		}
+	}
 };
 
-typedef StaticFIFO<Pixel, 16> PixelFIFO;
+#endif
@@ -34,10 +34,11 @@ bool IsControlFlagSet(LCDControlFlags flag, Memory& memory)
 	return (memory.ReadIO(LCDC_REGISTER) & (1 << static_cast<uint8_t>(flag))) > 0;
 }
 
-uint8_t GetColorForTilePixel(uint8_t index, uint8_t low, uint8_t high)
+uint8_t ReverseBits(uint8_t bits)
 {
-	index = 7 - index;
-	return (((high >> index) & 0x1) << 1) | ((low >> index) & 0x1);
+	bits = static_cast<uint8_t>((bits & 0xF0) >> 4 | (bits & 0x0F) << 4);
+	bits = static_cast<uint8_t>((bits & 0xCC) >> 2 | (bits & 0x33) << 2);
+	return static_cast<uint8_t>((bits & 0xAA) >> 1 | (bits & 0x55) << 1);
 }
 
 PixelFetcher::PixelFetcher(bool spriteMode) 
@@ -148,61 +149,27 @@ void PixelFetcher::PushPixels(PixelFIFO& fifo, uint8_t currentX)
 	if (m_spriteMode)
 	{
 		bool isOddPosition = m_spriteAttributes->m_posX != currentX + TILE_SIZE;
-
-		uint8_t start = fifo.Size();
 		uint8_t offscreenX = static_cast<uint8_t>(y::max(0, TILE_SIZE - static_cast<int16_t>(m_spriteAttributes->m_posX)));
-		start = offscreenX;
 
-		if (isOddPosition && start == 0)
+		if (isOddPosition && offscreenX == 0)
 		{
-			Pixel pixel{
-			0x00,
-			false,
-			false
-			};
-			fifo.Push(pixel);
+			fifo.PushTransparent();
 		}
 
-		for (uint8_t i = start; i < TILE_SIZE; ++i)
-		{	
-			bool flip = IsSpriteFlagSet(SpriteFlags::XFlip, m_spriteAttributes->m_flags);
-			uint8_t index = flip ? TILE_SIZE - 1 - i : i;
-			uint8_t color = GetColorForTilePixel(index, m_tileDataLow, m_tileDataHigh);
-			Pixel pixel{
-				color,
-				IsSpriteFlagSet(SpriteFlags::PaletteNr, m_spriteAttributes->m_flags),
-				IsSpriteFlagSet(SpriteFlags::BgOverObj, m_spriteAttributes->m_flags)
-			};
-			Pixel oldPixel;
-			uint8_t fifoIndex = isOddPosition ? i + 1 : i;
-			fifoIndex = y::max(0,fifoIndex - start);
-			if (fifo.Size() > fifoIndex)
-			{
-				oldPixel = fifo.Get(fifoIndex);
-				if (oldPixel.m_color == 0x00)
-				{
-					fifo.Replace(fifoIndex, pixel);
-				}
-			}
-			else
-			{
-				fifo.Push(pixel);
-			}
+		uint8_t low = m_tileDataLow;
+		uint8_t high = m_tileDataHigh;
+		if (IsSpriteFlagSet(SpriteFlags::XFlip, m_spriteAttributes->m_flags))
+		{
+			low = ReverseBits(low);
+			high = ReverseBits(high);
 		}
+
+		fifo.MergeRow(isOddPosition ? 1 : 0, static_cast<uint8_t>(low << offscreenX), static_cast<uint8_t>(high << offscreenX), TILE_SIZE - offscreenX,
+			IsSpriteFlagSet(SpriteFlags::PaletteNr, m_spriteAttributes->m_flags), IsSpriteFlagSet(SpriteFlags::BgOverObj, m_spriteAttributes->m_flags));
 	}
 	else
 	{
-		for (uint8_t i = 0; i < TILE_SIZE; ++i)
-		{
-			uint8_t color = GetColorForTilePixel(i, m_tileDataLow, m_tileDataHigh);
-			Pixel pixel{
-				color,
-				0,
-				0
-			};
-			fifo.Push(pixel);
-		}
-
+		fifo.PushRow(m_tileDataLow, m_tileDataHigh);
 		m_x++;
 	}
 
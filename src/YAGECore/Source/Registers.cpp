@@ -1 +1,48 @@
 #include "Registers.h"
+
+uint8_t Registers::ComputePendingFlags() const
+{
+	const uint8_t op1 = m_pendingOperand1;
+	const uint8_t op2 = m_pendingOperand2;
+
+	uint8_t result = 0;
+	uint8_t flags = FLAGS & ~static_cast<uint8_t>(Flags::all);
+
+	switch (m_pendingFlags)
+	{
+	case PendingFlags::Add:
+		result = static_cast<uint8_t>(op1 + op2);
+		flags |= static_cast<uint8_t>(Flags::cy) * (static_cast<uint16_t>(op1) + static_cast<uint16_t>(op2) > 0xFF);
+		flags |= static_cast<uint8_t>(Flags::h) * ((op1 & 0xF) + (op2 & 0xF) > 0xF);
+		break;
+	case PendingFlags::Sub:
+		result = static_cast<uint8_t>(op1 - op2);
+		flags |= static_cast<uint8_t>(Flags::cy) * (op1 < op2);
+		flags |= static_cast<uint8_t>(Flags::h) * (((static_cast<int16_t>(op1 & 0xF) - static_cast<int16_t>(op2 & 0xF)) & 0x10) > 0);
+		flags |= static_cast<uint8_t>(Flags::n);
+		break;
+	case PendingFlags::Inc:
+		result = static_cast<uint8_t>(op1 + op2);
+		flags |= FLAGS & static_cast<uint8_t>(Flags::cy);
+		flags |= static_cast<uint8_t>(Flags::h) * ((op1 & 0xF) + (op2 & 0xF) > 0xF);
+		break;
+	case PendingFlags::Dec:
+		result = static_cast<uint8_t>(op1 - op2);
+		flags |= FLAGS & static_cast<uint8_t>(Flags::cy);
+		flags |= static_cast<uint8_t>(Flags::h) * (((static_cast<int16_t>(op1 & 0xF) - static_cast<int16_t>(op2 & 0xF)) & 0x10) > 0);
+		flags |= static_cast<uint8_t>(Flags::n);
+		break;
+	case PendingFlags::And:
+		result = op1;
+		flags |= static_cast<uint8_t>(Flags::h);
+		break;
+	case PendingFlags::Or:
+		result = op1;
+		break;
+	default:
+		return FLAGS;
+	}
+
+	flags |= static_cast<uint8_t>(Flags::zf) * (result == 0);
+	return flags;
+}
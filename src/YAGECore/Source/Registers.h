@@ -29,6 +29,19 @@ struct Registers
 		Stop = 2
 	};
 
+	// Flags of the last 8 bit ALU operation are only computed once something reads them.
+	// While an operation is pending, FLAGS is stale, apart from the carry kept by INC/DEC.
+	enum class PendingFlags : uint8_t
+	{
+		None = 0,
+		Add,
+		Sub,
+		Inc,
+		Dec,
+		And,
+		Or, // Also XOR, both only leave the zero flag
+	};
+
 	union // Accumulator & Flags
 	{
 		uint16_t AF;
@@ -76,30 +89,73 @@ struct Registers
 
 	State CpuState;
 
+	// Not part of the architectural state, everything from here on is left out of save states
+	PendingFlags m_pendingFlags;
+	uint8_t m_pendingOperand1;
+	uint8_t m_pendingOperand2;
+
+	void SetPendingFlags(PendingFlags op, uint8_t operand1, uint8_t operand2)
+	{
+		// INC/DEC keep the carry, which has to be in FLAGS for them to pick it up
+		if (op == PendingFlags::Inc || op == PendingFlags::Dec)
+		{
+			ResolveFlags();
+		}
+
+		m_pendingFlags = op;
+		m_pendingOperand1 = operand1;
+		m_pendingOperand2 = operand2;
+	}
+
+	void DiscardPendingFlags()
+	{
+		m_pendingFlags = PendingFlags::None;
+		m_pendingOperand1 = 0;
+		m_pendingOperand2 = 0;
+	}
+
+	void ResolveFlags()
+	{
+		if (m_pendingFlags != PendingFlags::None)
+		{
+			FLAGS = ComputePendingFlags();
+			DiscardPendingFlags();
+		}
+	}
+
+	uint8_t GetFlags() const
+	{
+		return m_pendingFlags == PendingFlags::None ? FLAGS : ComputePendingFlags();
+	}
+
 	void SetFlag(Flags flag)
 	{
+		ResolveFlags();
 		FLAGS |= static_cast<uint8_t>(flag);
 	}
 
 	void SetFlag(Flags flag, uint8_t val)
 	{
+		ResolveFlags();
 		FLAGS &= (~static_cast<uint8_t>(flag));
 		FLAGS |= (static_cast<uint8_t>(flag) * val);
 	}
 
 	void OrFlag(Flags flag, uint8_t val)
 	{
+		ResolveFlags();
 		FLAGS |= (static_cast<uint8_t>(flag) * val);
 	}
 
 	void ResetFlag(Flags flag)
 	{
+		ResolveFlags();
 		FLAGS &= (~static_cast<uint8_t>(flag));
 	}
 
 	bool IsFlagSet(Flags flag) const
 	{
-		return (FLAGS & static_cast<uint8_t>(flag)) != 0;
+		return (GetFlags() & static_cast<uint8_t>(flag)) != 0;
 	}
 
 	uint8_t GetFlag(Flags flag) const
@@ -109,9 +165,13 @@ struct Registers
 	
 	void SetAllFlags(uint8_t val)
 	{
+		DiscardPendingFlags();
 		FLAGS &= ~static_cast<uint8_t>(Flags::all);
 		FLAGS |= (val & static_cast<uint8_t>(Flags::all));
 	}
-	
+
+private:
+	uint8_t ComputePendingFlags() const;
 };
 
+#define REGISTERS_SERIALIZATION_SIZE offsetof_y(Registers, m_pendingFlags)
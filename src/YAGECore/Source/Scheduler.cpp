@@ -0,0 +1,66 @@
+#include "Scheduler.h"
+
+#define EVENT_COUNT static_cast<uint32_t>(SchedulerEvent::Count)
+
+Scheduler::Scheduler()
+{
+	Reset();
+}
+
+void Scheduler::Reset()
+{
+	m_currentCycle = 0;
+	ScheduleAll(1);
+}
+
+void Scheduler::Schedule(SchedulerEvent event, uint64_t cycle)
+{
+	uint64_t& eventCycle = m_eventCycles[static_cast<uint32_t>(event)];
+	bool wasNextEvent = eventCycle == m_nextEventCycle;
+	eventCycle = cycle;
+
+	if (cycle <= m_nextEventCycle)
+	{
+		m_nextEventCycle = cycle;
+	}
+	else if (wasNextEvent)
+	{
+		UpdateNextEvent();
+	}
+}
+
+void Scheduler::ScheduleIn(SchedulerEvent event, uint64_t mCycles)
+{
+	Schedule(event, m_currentCycle + mCycles);
+}
+
+void Scheduler::ScheduleAll(uint64_t cycle)
+{
+	for (uint32_t i = 0; i < EVENT_COUNT; ++i)
+	{
+		m_eventCycles[i] = cycle;
+	}
+	m_nextEventCycle = cycle;
+}
+
+void Scheduler::Deschedule(SchedulerEvent event)
+{
+	Schedule(event, SCHEDULER_NO_EVENT);
+}
+
+uint64_t Scheduler::GetNextEventCycle() const
+{
+	return m_nextEventCycle;
+}
+
+void Scheduler::UpdateNextEvent()
+{
+	m_nextEventCycle = SCHEDULER_NO_EVENT;
+	for (uint32_t i = 0; i < EVENT_COUNT; ++i)
+	{
+		if (m_eventCycles[i] < m_nextEventCycle)
+		{
+			m_nextEventCycle = m_eventCycles[i];
+		}
+	}
+}
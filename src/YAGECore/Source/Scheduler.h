@@ -0,0 +1,64 @@
+#pragma once
+#include "CppIncludes.h"
+
+#define SCHEDULER_NO_EVENT 0xFFFFFFFFFFFFFFFFull
+
+enum class SchedulerEvent : uint8_t
+{
+	DMA = 0,
+	Joypad,
+	Timer,
+	PPU,
+	Serial,
+	APU,
+	Count
+};
+
+// Keeps track of the next m-cycle at which each component has to be updated.
+// Components post their own next event and catch up on the cycles in between when they are due.
+class Scheduler
+{
+public:
+	Scheduler();
+
+	void Reset();
+
+	void Advance()
+	{
+		m_currentCycle++;
+	}
+
+	void Advance(uint64_t mCycles)
+	{
+		m_currentCycle += mCycles;
+	}
+
+	uint64_t GetCurrentCycle() const
+	{
+		return m_currentCycle;
+	}
+
+	bool HasDueEvents() const
+	{
+		return m_nextEventCycle <= m_currentCycle;
+	}
+
+	bool IsDue(SchedulerEvent event) const
+	{
+		return m_eventCycles[static_cast<uint32_t>(event)] <= m_currentCycle;
+	}
+
+	void Schedule(SchedulerEvent event, uint64_t cycle);
+	void ScheduleIn(SchedulerEvent event, uint64_t mCycles);
+	void ScheduleAll(uint64_t cycle);
+	void Deschedule(SchedulerEvent event);
+
+	uint64_t GetNextEventCycle() const;
+
+private:
+	void UpdateNextEvent();
+
+	uint64_t m_currentCycle;
+	uint64_t m_nextEventCycle;
+	uint64_t m_eventCycles[static_cast<uint32_t>(SchedulerEvent::Count)];
+};
@@ -10,7 +10,8 @@
 
 #define TRANSFER_CLOCK_MCYCLES 32
 
-Serial::Serial(GamestateSerializer* serializer) : ISerializable(serializer, ChunkId::Serial)
+Serial::Serial(GamestateSerializer* serializer, Scheduler* scheduler) : ISerializable(serializer, ChunkId::Serial)
+	, m_scheduler(scheduler)
 {
 	m_accumulatedCycles = 0;
 	m_bitsTransferred = 0;
@@ -29,12 +30,7 @@ void Serial::Init(Memory& memory)
 
 void Serial::Update(Memory& memory, uint32_t mCycles)
 {
-	if(m_mode == SerialMode::None)
-	{
-		return;
-	}
-
-	if ((memory[SC_REGISTER] & SC_TRANSFER_ENABLE_MASK) > 0)
+	if (IsTransferActive(memory))
 	{
 		m_accumulatedCycles += mCycles;
 
@@ -44,7 +40,20 @@ void Serial::Update(Memory& memory, uint32_t mCycles)
 			TransferNextBit(memory);
 		}
 	}
-	
+
+	if (IsTransferActive(memory))
+	{
+		m_scheduler->ScheduleIn(SchedulerEvent::Serial, 1);
+	}
+	else
+	{
+		m_scheduler->Deschedule(SchedulerEvent::Serial);
+	}
+}
+
+bool Serial::IsTransferActive(Memory& memory) const
+{
+	return m_mode != SerialMode::None && (memory[SC_REGISTER] & SC_TRANSFER_ENABLE_MASK) > 0;
 }
 
 void Serial::ResetClock(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
@@ -55,6 +64,11 @@ void Serial::ResetClock(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_
 		serial->m_accumulatedCycles = 0;
 		serial->m_bitsTransferred = 0;
 	}
+
+	if (serial->IsTransferActive(*memory))
+	{
+		serial->m_scheduler->ScheduleIn(SchedulerEvent::Serial, 1);
+	}
 }
 
 void Serial::TransferNextBit(Memory& memory)
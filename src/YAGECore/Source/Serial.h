@@ -1,5 +1,6 @@
 #pragma once
 #include "Memory.h"
+#include "Scheduler.h"
 
 enum class SerialMode : uint8_t
 {
@@ -11,11 +12,13 @@ enum class SerialMode : uint8_t
 class Serial : ISerializable
 {
 public:
-	Serial(GamestateSerializer* serializer);
+	Serial(GamestateSerializer* serializer, Scheduler* scheduler);
 	void Init(Memory& memory);
 	void Update(Memory& memory, uint32_t mCycles);
 private:
 
+	bool IsTransferActive(Memory& memory) const;
+
 	void Serialize(uint8_t* data) override;
 	void Deserialize(const uint8_t* data) override;
 	virtual uint32_t GetSerializationSize() override;
@@ -26,5 +29,6 @@ private:
 	uint32_t m_accumulatedCycles;
 	uint32_t m_bitsTransferred;
 	SerialMode m_mode;
+	Scheduler* m_scheduler;
 };
 
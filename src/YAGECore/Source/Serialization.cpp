@@ -6,7 +6,7 @@
 #define HEADER_MAGIC_TOKEN 4142
 
 // Bump this on major changes to the file format
-#define HEADER_CURRENT_VERSION 2
+#define HEADER_CURRENT_VERSION 4
 
 namespace Serializer_Internal
 {
@@ -60,7 +60,8 @@ namespace Serializer_Internal
 	}
 }
 
-GamestateSerializer::GamestateSerializer()
+GamestateSerializer::GamestateSerializer(Allocator* allocator)
+	: m_serializationBuffer(allocator)
 {
 	m_registeredComponentCount = 0;
 	for (auto& component : m_components)
@@ -85,7 +85,7 @@ private:
 class GamestateSerializer
 {
 public:
-	GamestateSerializer();
+	explicit GamestateSerializer(Allocator* allocator);
 	void RegisterComponent(ISerializable* component, ChunkId id);
 	SerializationView Serialize(uint8_t headerChecksum, const yString& romName, bool rawData);
 	void Deserialize(const SerializationView& data, uint8_t headerChecksum);
@@ -0,0 +1,34 @@
+#include "TileCache.h"
+
+namespace
+{
+	// Moves bit 7 - n of the tile data byte to bit 0 of byte n, all 8 pixels at once
+	uint64_t SpreadBits(uint8_t bits)
+	{
+		uint64_t spread = (bits * 0x0101010101010101ull) & 0x0102040810204080ull;
+		// Every byte holds at most a single bit, adding 0x7F carries it into the top bit without spilling into the next byte
+		return ((spread + 0x7F7F7F7F7F7F7F7Full) >> 7) & 0x0101010101010101ull;
+	}
+}
+
+TileCache::TileCache()
+{
+	InvalidateAll();
+}
+
+void TileCache::InvalidateAll()
+{
+	memset_y(m_isDirty, 1, sizeof(m_isDirty));
+}
+
+void TileCache::Decode(uint32_t tile, const uint8_t* memory)
+{
+	const uint8_t* tileData = memory + TILE_CACHE_START + tile * TILE_CACHE_ROW_COUNT * 2;
+	for (uint32_t row = 0; row < TILE_CACHE_ROW_COUNT; ++row)
+	{
+		uint64_t pixels = SpreadBits(tileData[row * 2]) | (SpreadBits(tileData[row * 2 + 1]) << 1);
+		// Byte n is pixel n on little endian hosts, which all supported platforms are
+		memcpy_y(m_rows[tile][row], &pixels, sizeof(pixels));
+	}
+	m_isDirty[tile] = false;
+}
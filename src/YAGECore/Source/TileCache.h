@@ -0,0 +1,43 @@
+#pragma once
+#include "CppIncludes.h"
+
+#define TILE_CACHE_START 0x8000
+#define TILE_CACHE_END 0x97FF
+#define TILE_CACHE_TILE_COUNT 384
+#define TILE_CACHE_ROW_COUNT 8
+#define TILE_CACHE_ROW_SIZE 8
+
+// The tile data in VRAM decoded to one color index per pixel.
+// Writes only mark a tile as dirty, it gets decoded again the next time one of its rows is drawn.
+class TileCache
+{
+public:
+	TileCache();
+
+	void Invalidate(uint16_t addr)
+	{
+		if (addr >= TILE_CACHE_START && addr <= TILE_CACHE_END)
+		{
+			m_isDirty[(addr - TILE_CACHE_START) >> 4] = true;
+		}
+	}
+
+	void InvalidateAll();
+
+	// Color indices of the tile row starting at addr, leftmost pixel first
+	const uint8_t* GetRow(uint16_t addr, const uint8_t* memory)
+	{
+		uint32_t tile = (addr - TILE_CACHE_START) >> 4;
+		if (m_isDirty[tile])
+		{
+			Decode(tile, memory);
+		}
+		return m_rows[tile][(addr >> 1) & (TILE_CACHE_ROW_COUNT - 1)];
+	}
+
+private:
+	void Decode(uint32_t tile, const uint8_t* memory);
+
+	uint8_t m_rows[TILE_CACHE_TILE_COUNT][TILE_CACHE_ROW_COUNT][TILE_CACHE_ROW_SIZE];
+	bool m_isDirty[TILE_CACHE_TILE_COUNT];
+};
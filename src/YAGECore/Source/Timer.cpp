@@ -15,30 +15,39 @@ const uint32_t TIMER_SPEED_BITS[4]
 	128
 };
 
+#define TIMA_OVERFLOW 0x100
+
 namespace
 {
-	bool IsTimerEnabled(Memory& memory)
+	bool IsTimerEnabled(uint8_t tac)
 	{
-		return (memory.ReadIO(TAC_REGISTER) & 0x4) > 0;
+		return (tac & 0x4) > 0;
 	}
 
-	uint16_t GetTimerFrequency(Memory& memory)
+	uint16_t GetTimerFrequency(uint8_t tac)
 	{
-		return TIMER_SPEED_BITS[memory.ReadIO(TAC_REGISTER) & 0x3];
+		return TIMER_SPEED_BITS[tac & 0x3];
 	}
 }
 
 
 Timer::Timer()
-	: Timer(nullptr)
+	: Timer(nullptr, nullptr)
 {
 }
 
-Timer::Timer(GamestateSerializer* serializer)
+Timer::Timer(GamestateSerializer* serializer, Scheduler* scheduler)
 	: ISerializable(serializer, ChunkId::Timer)
 	, m_previousCycleTimerModuloEdge(false)
 	, m_divTotal(0)
 	, m_TIMAReloadState(TIMAReloadState::None)
+	, m_scheduler(scheduler)
+	, m_memory(nullptr)
+	, m_syncedCycle(0)
+	, m_cachedTimerBits(0)
+	, m_cachedTimerEnabled(false)
+	, m_cachedTMA(0)
+	, m_cachedTIMA(0)
 {
 }
 
@@ -57,19 +66,115 @@ void Timer::Init(Memory& memory)
 	memory.RegisterCallback(TAC_REGISTER, Timer::WriteTAC, this);
 
 	memory.AddIOUnusedBitsOverride(TAC_REGISTER, 0b11111000);
+
+	m_memory = &memory;
+	ResetSync();
+}
+
+void Timer::Update(Memory& memory)
+{
+	uint64_t currentCycle = m_scheduler->GetCurrentCycle();
+	Advance(static_cast<uint32_t>(currentCycle - m_syncedCycle), memory);
+	m_syncedCycle = currentCycle;
+	ScheduleNextUpdate();
+}
+
+void Timer::Sync()
+{
+	CatchUp(m_scheduler->GetCurrentCycle());
+}
+
+void Timer::ResetSync()
+{
+	// The registers might have been replaced without going through the callbacks, by loading a save state
+	RefreshCachedRegisters();
+	m_syncedCycle = m_scheduler->GetCurrentCycle();
+	m_scheduler->ScheduleIn(SchedulerEvent::Timer, 1);
+}
+
+uint16_t Timer::GetDivider()
+{
+	Sync();
+	return m_divTotal;
+}
+
+// The m-cycles since the last update contained neither a DIV write nor a falling edge, so only the divider moved
+void Timer::CatchUp(uint64_t cycle)
+{
+	if (cycle > m_syncedCycle)
+	{
+		m_divTotal += static_cast<uint16_t>((cycle - m_syncedCycle) * MCYCLES_TO_CYCLES);
+		m_previousCycleTimerModuloEdge = (m_divTotal & m_cachedTimerBits) && m_cachedTimerEnabled;
+		m_syncedCycle = cycle;
+	}
+}
+
+void Timer::ScheduleNextUpdate()
+{
+	if (m_TIMAReloadState != TIMAReloadState::None)
+	{
+		m_scheduler->ScheduleIn(SchedulerEvent::Timer, 1);
+		return;
+	}
+
+	// Next t-cycle that either overflows the low byte of DIV or produces a falling edge on the selected bit
+	uint32_t period = 0x100;
+	if (m_cachedTimerEnabled && m_cachedTimerBits * 2u < period)
+	{
+		period = m_cachedTimerBits * 2u;
+	}
+	uint32_t cyclesToEvent = period - (m_divTotal % period);
+	m_scheduler->ScheduleIn(SchedulerEvent::Timer, (cyclesToEvent + MCYCLES_TO_CYCLES - 1) / MCYCLES_TO_CYCLES);
 }
 
-void Timer::Increment(uint32_t tCycle, Memory& memory)
+// The reload after an overflow happens at the start of the following m-cycle, so while one is pending the timer goes one m-cycle at a time.
+// Otherwise everything up to the m-cycle that overflows TIMA is stepped at once
+void Timer::Advance(uint32_t mCycles, Memory& memory)
 {
-	uint32_t cyclesToStep = tCycle;
+	while (mCycles > 0)
+	{
+		StepReloadState(memory);
+
+		uint32_t cycles = mCycles;
+		if (m_TIMAReloadState != TIMAReloadState::None)
+		{
+			cycles = 1;
+		}
+		else
+		{
+			uint32_t cyclesToOverflow = GetCyclesToOverflow();
+			cycles = cycles < cyclesToOverflow ? cycles : cyclesToOverflow;
+		}
+
+		// There is at most the one edge that overflows TIMA, no other fits into the rest of its m-cycle
+		uint32_t edges = AdvanceDivider(cycles * MCYCLES_TO_CYCLES);
+		if (edges > 0)
+		{
+			if (m_cachedTIMA + edges >= TIMA_OVERFLOW)
+			{
+				m_cachedTIMA = 0x00;
+				m_TIMAReloadState = TIMAReloadState::Overflowed;
+			}
+			else
+			{
+				m_cachedTIMA = static_cast<uint8_t>(m_cachedTIMA + edges);
+			}
+			memory.WriteDirect(TIMA_REGISTER, m_cachedTIMA);
+		}
 
-	bool isTimerEnabled = IsTimerEnabled(memory);
-	uint16_t timerBits = GetTimerFrequency(memory);
+		mCycles -= cycles;
+	}
 
+	memory.WriteDirect(DIVIDER_REGISTER, m_divHigh);
+}
+
+void Timer::StepReloadState(Memory& memory)
+{
 	switch (m_TIMAReloadState)
 	{
 	case TIMAReloadState::Overflowed:
-		memory.WriteDirect(TIMA_REGISTER, memory[TMA_REGISTER]);
+		m_cachedTIMA = m_cachedTMA;
+		memory.WriteDirect(TIMA_REGISTER, m_cachedTIMA);
 		Interrupts::RequestInterrupt(Interrupts::Types::Timer, memory);
 		m_TIMAReloadState = TIMAReloadState::InterruptTriggered;
 		break;
@@ -79,43 +184,73 @@ void Timer::Increment(uint32_t tCycle, Memory& memory)
 	default:
 		break;
 	}
+}
 
-	while (cyclesToStep > 0)
+// M-cycles up to and including the one with the falling edge that overflows TIMA
+uint32_t Timer::GetCyclesToOverflow() const
+{
+	if (!m_cachedTimerEnabled)
 	{
-		m_divTotal++;
-		if (m_divLow == 0) // overflow
-		{
-			memory.WriteDirect(DIVIDER_REGISTER, m_divHigh);
-		}
+		return 0xFFFFFFFFu;
+	}
 
-		CheckForTimerTick(timerBits, isTimerEnabled, memory);
+	uint32_t edgesToOverflow = TIMA_OVERFLOW - m_cachedTIMA;
+	uint32_t next = static_cast<uint16_t>(m_divTotal + 1);
+	bool isFirstCycleEdge = m_previousCycleTimerModuloEdge && !(next & m_cachedTimerBits);
 
-		cyclesToStep--;
+	uint32_t tCycles = 1;
+	if (!isFirstCycleEdge || edgesToOverflow > 1)
+	{
+		uint32_t period = m_cachedTimerBits * 2u;
+		uint32_t remainingEdges = edgesToOverflow - (isFirstCycleEdge ? 1 : 0);
+		tCycles = (next / period + remainingEdges) * period - next + 1;
 	}
+	return (tCycles + MCYCLES_TO_CYCLES - 1) / MCYCLES_TO_CYCLES;
 }
 
-void Timer::CheckForTimerTick(uint16_t timerBits, bool isTimerEnabled, Memory& memory)
+// Returns the falling edges of the selected bit. The first t-cycle compares against the stored level, which doesn't match the divider
+// right after a DIV or TAC write. From there on the level follows the divider, the bit falls every time it passes a multiple of twice the bit
+uint32_t Timer::AdvanceDivider(uint32_t tCycles)
 {
-	bool currentFrequencyEdge = (m_divTotal & timerBits) && isTimerEnabled;
-	if (m_previousCycleTimerModuloEdge && !currentFrequencyEdge)
+	m_divTotal++;
+	bool currentFrequencyEdge = (m_divTotal & m_cachedTimerBits) && m_cachedTimerEnabled;
+	uint32_t edges = m_previousCycleTimerModuloEdge && !currentFrequencyEdge ? 1 : 0;
+
+	// The period divides 2^16, so multiples can be counted past the wrap around
+	uint32_t start = m_divTotal;
+	uint32_t end = start + tCycles - 1;
+	if (m_cachedTimerEnabled)
 	{
-		TickTimer(memory);
+		uint32_t period = m_cachedTimerBits * 2u;
+		edges += end / period - start / period;
 	}
-	m_previousCycleTimerModuloEdge = currentFrequencyEdge;
+
+	m_divTotal = static_cast<uint16_t>(end);
+	m_previousCycleTimerModuloEdge = (m_divTotal & m_cachedTimerBits) && m_cachedTimerEnabled;
+	return edges;
 }
 
 void Timer::TickTimer(Memory& memory)
 {
-	uint8_t TIMA = memory.ReadIO(TIMA_REGISTER);
-	if (TIMA == 0xFF)
+	if (m_cachedTIMA == 0xFF)
 	{
-		memory.WriteDirect(TIMA_REGISTER, 0x00);
+		m_cachedTIMA = 0x00;
 		m_TIMAReloadState = TIMAReloadState::Overflowed;
 	}
 	else
 	{
-		memory.WriteDirect(TIMA_REGISTER, TIMA + 1);
+		m_cachedTIMA++;
 	}
+	memory.WriteDirect(TIMA_REGISTER, m_cachedTIMA);
+}
+
+void Timer::RefreshCachedRegisters()
+{
+	uint8_t tac = m_memory->ReadIO(TAC_REGISTER);
+	m_cachedTimerBits = GetTimerFrequency(tac);
+	m_cachedTimerEnabled = IsTimerEnabled(tac);
+	m_cachedTMA = m_memory->ReadIO(TMA_REGISTER);
+	m_cachedTIMA = m_memory->ReadIO(TIMA_REGISTER);
 }
 
 void Timer::Reset()
@@ -128,7 +263,9 @@ void Timer::ResetDivider(Memory* memory, uint16_t addr, uint8_t prevValue, uint8
 {
 	memory->WriteDirect(DIVIDER_REGISTER, 0);
 	Timer* timer = static_cast<Timer*>(userData);
+	timer->Sync();
 	timer->m_divTotal = 0;
+	timer->m_scheduler->ScheduleIn(SchedulerEvent::Timer, 1);
 }
 
 void Timer::WriteTIMA(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
@@ -143,16 +280,20 @@ void Timer::WriteTIMA(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t
 	else if (timer->m_TIMAReloadState == TIMAReloadState::InterruptTriggered)
 	{
 		memory->WriteDirect(TIMA_REGISTER, prevValue);
+		return;
 	}
+	timer->m_cachedTIMA = newValue;
 }
 
 void Timer::WriteTMA(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
 {
 	Timer* timer = static_cast<Timer*>(userData);
+	timer->m_cachedTMA = newValue;
 
 	//Hardware quirk: writing to TMA the cycle after TIMA overflowed applies the new TMA value to TIMA as well.
 	if (timer->m_TIMAReloadState == TIMAReloadState::InterruptTriggered)
 	{
+		timer->m_cachedTIMA = newValue;
 		memory->WriteDirect(TIMA_REGISTER, newValue);
 	}
 }
@@ -160,12 +301,19 @@ void Timer::WriteTMA(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t n
 void Timer::WriteTAC(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData)
 {
 	Timer* timer = static_cast<Timer*>(userData);
+	timer->Sync();
+	timer->m_scheduler->ScheduleIn(SchedulerEvent::Timer, 1);
+
 	// Hardware quirk: Disabling the timer while the cycle bits were true will cause an additional tick
-	if (timer->m_previousCycleTimerModuloEdge && !IsTimerEnabled(*memory))
+	if (timer->m_previousCycleTimerModuloEdge && !IsTimerEnabled(newValue))
 	{
 		timer->TickTimer(*memory);
 		timer->m_previousCycleTimerModuloEdge = false;
-	}	
+	}
+
+	// The cycles up to the write still ran with the previous value
+	timer->m_cachedTimerBits = GetTimerFrequency(newValue);
+	timer->m_cachedTimerEnabled = IsTimerEnabled(newValue);
 }
 
 void Timer::Serialize(uint8_t* data)
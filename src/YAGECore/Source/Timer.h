@@ -1,16 +1,24 @@
 #pragma once
 #include "CppIncludes.h"
 #include "Memory.h"
+#include "Scheduler.h"
 
 class Timer : ISerializable
 {
 public:
 	Timer();
-	explicit Timer(GamestateSerializer* serializer);
+	Timer(GamestateSerializer* serializer, Scheduler* scheduler);
 
 	void Init(Memory& memory);
 
-	void Increment(uint32_t mCycles, Memory& memory);
+	void Update(Memory& memory);
+	// Steps the given m-cycles at once, counting the falling edges of the selected divider bit instead of going through every t-cycle
+	void Advance(uint32_t mCycles, Memory& memory);
+	void Sync();
+	void ResetSync();
+
+	// Brings the divider up to the current m-cycle
+	uint16_t GetDivider();
 
 	void Reset();
 
@@ -20,8 +28,13 @@ public:
 	static void WriteTAC(Memory* memory, uint16_t addr, uint8_t prevValue, uint8_t newValue, void* userData);
 
 private:
-	void CheckForTimerTick(uint16_t timerBits, bool isTimerEnabled, Memory& memory);
+	void StepReloadState(Memory& memory);
+	uint32_t GetCyclesToOverflow() const;
+	uint32_t AdvanceDivider(uint32_t tCycles);
 	void TickTimer(Memory& memory);
+	void RefreshCachedRegisters();
+	void CatchUp(uint64_t cycle);
+	void ScheduleNextUpdate();
 
 	void Serialize(uint8_t* data) override;
 	void Deserialize(const uint8_t* data) override;
@@ -45,5 +58,15 @@ private:
 	};
 	bool m_previousCycleTimerModuloEdge;
 	TIMAReloadState m_TIMAReloadState;
+
+	Scheduler* m_scheduler;
+	Memory* m_memory;
+	uint64_t m_syncedCycle;
+
+	// Copies of TAC, TMA & TIMA, kept up to date by the write callbacks & the timer itself
+	uint16_t m_cachedTimerBits;
+	bool m_cachedTimerEnabled;
+	uint8_t m_cachedTMA;
+	uint8_t m_cachedTIMA;
 };
 
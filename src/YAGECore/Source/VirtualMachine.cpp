@@ -2,21 +2,35 @@
 
 #define ROM_ENTRY_POINT 0x0100
 
-VirtualMachine::VirtualMachine()
-	: m_serializer()
-	, m_memory(&m_serializer)
-	, m_cpu(&m_serializer)
+namespace
+{
+	double GetCycleDurationMs(uint32_t tCycles, float turboSpeed)
+	{
+		double cycleDurationS = static_cast<double>(tCycles) / (static_cast<double>(CPU_FREQUENCY) * static_cast<double>(turboSpeed));
+		return cycleDurationS * 1000.0;
+	}
+}
+
+VirtualMachine::VirtualMachine(Allocator* allocator)
+	: Emulator(allocator)
+	, m_serializer(allocator)
+	, m_scheduler()
+	, m_memory(allocator, &m_serializer, &m_scheduler)
+	, m_cpu(allocator, &m_serializer)
 	, m_totalCycles(0)
-	, m_joypad()
-	, m_clock(&m_serializer)
+	, m_joypad(&m_scheduler)
+	, m_clock(&m_serializer, &m_scheduler)
 	, m_frameRendered(false)
 	, m_stepDuration(0.0)
-	, m_ppu(&m_serializer)
-	, m_apu(&m_serializer)
+	, m_ppu(allocator, &m_serializer, &m_scheduler)
+	, m_apu(&m_serializer, &m_scheduler, &m_clock)
 	, m_samplesGenerated(0)
 	, m_turbospeed(1)
-	, m_serial(&m_serializer)
+	, m_serial(&m_serializer, &m_scheduler)
 	, m_tCyclesStepped(0)
+	, m_skippedPollingCycles(0)
+	, m_pollingLoopCycle(SCHEDULER_NO_EVENT)
+	, m_pollingLoopEventCycle(SCHEDULER_NO_EVENT)
 {
 }
 
@@ -24,6 +38,9 @@ void VirtualMachine::Load(const char* romName, const char* rom, uint32_t size)
 {
 	m_romName.Assign(romName);
 
+	m_scheduler.Reset();
+	m_skippedPollingCycles = 0;
+
 	// Setup memory
 	m_memory.ClearMemory();
 	m_memory.MapROM(&m_serializer, rom, size);
@@ -63,47 +80,235 @@ void VirtualMachine::SetAudioBuffer(float* buffer, uint32_t size, uint32_t sampl
 }
 
 void VirtualMachine::Step(EmulatorInputs::InputState inputState, double deltaMs, bool microStepping)
+{
+	// Convert the elapsed time into a whole number of t-cycles, the time run ahead or behind carries over to the next step
+	const double cycleDurationMs = GetCycleDurationMs(1, m_turbospeed);
+	const double remainingMs = deltaMs - m_stepDuration;
+
+	uint64_t tCycles = 0;
+	if (remainingMs > 0.0)
+	{
+		tCycles = static_cast<uint64_t>(remainingMs / cycleDurationMs);
+		if (static_cast<double>(tCycles) * cycleDurationMs < remainingMs)
+		{
+			tCycles++;
+		}
+	}
+
+	uint64_t cyclesRun = Run(inputState, tCycles, microStepping, false);
+	m_stepDuration += static_cast<double>(cyclesRun) * cycleDurationMs - deltaMs;
+}
+
+uint64_t VirtualMachine::RunCycles(EmulatorInputs::InputState inputState, uint64_t tCycles)
+{
+	return Run(inputState, tCycles, false, false);
+}
+
+uint64_t VirtualMachine::RunUntilVBlank(EmulatorInputs::InputState inputState)
+{
+	// VBlank is at most one frame away, the limit only matters while the LCD is off
+	return Run(inputState, EmulatorConstants::TCYCLES_PER_FRAME, false, true);
+}
+
+uint64_t VirtualMachine::Run(EmulatorInputs::InputState inputState, uint64_t tCycles, bool microStepping, bool stopAtVBlank)
 {
 	m_totalCycles = 0;
-	m_samplesGenerated = 0;
-	while (m_stepDuration < deltaMs)
+	m_joypad.SetInputState(inputState);
+
+	// A new input state can schedule events the last polling loop iteration didn't see
+	m_pollingLoopCycle = SCHEDULER_NO_EVENT;
+
+	// The loop is picked once per call, only the instrumented ones pay for the debugger hooks
+	const bool instrumented = m_cpu.HasDebugHooks();
+
+	if (microStepping)
 	{
-		bool tCycleStep = false;
-		uint32_t cyclesPassed = microStepping ? 1 : MCYCLES_TO_CYCLES; // step either 1 or 4 tcycles. 
-		m_tCyclesStepped += cyclesPassed;
-		if (m_tCyclesStepped >= MCYCLES_TO_CYCLES)
+		// The PPU is stepped every t-cycle, so it can't skip ahead
+		m_ppu.Sync();
+
+		if (instrumented)
 		{
-			m_tCyclesStepped = 0;
-			tCycleStep = true;
+			RunLoop<true, true>(tCycles, stopAtVBlank);
+		}
+		else
+		{
+			RunLoop<true, false>(tCycles, stopAtVBlank);
+		}
+
+		m_ppu.ResetSync();
+	}
+	else
+	{
+		if (instrumented)
+		{
+			RunLoop<false, true>(tCycles, stopAtVBlank);
+		}
+		else
+		{
+			RunLoop<false, false>(tCycles, stopAtVBlank);
+		}
+	}
+
+	// The host reads the audio buffer after every call
+	m_apu.Sync();
+	m_samplesGenerated = m_apu.TakeGeneratedSamples();
+
+	return m_totalCycles;
+}
+
+template<bool microStepping, bool instrumented>
+void VirtualMachine::RunLoop(uint64_t tCycles, bool stopAtVBlank)
+{
+	const uint32_t cyclesPassed = microStepping ? 1 : MCYCLES_TO_CYCLES; // step either 1 or 4 tcycles. 
+	const uint64_t startFrame = m_ppu.GetCompletedFrames();
+
+	while (m_totalCycles < tCycles)
+	{
+		bool tCycleStep = true;
+		if (microStepping)
+		{
+			m_tCyclesStepped += cyclesPassed;
+			tCycleStep = m_tCyclesStepped >= MCYCLES_TO_CYCLES;
 		}
 
 		if (tCycleStep)
 		{
-			m_memory.Update();
-			m_joypad.Update(inputState, m_memory);
-			m_clock.Increment(MCYCLES_TO_CYCLES, m_memory);
+			m_tCyclesStepped = 0;
+			m_scheduler.Advance();
+			if (m_scheduler.HasDueEvents())
+			{
+				RunDueEvents<microStepping>();
+			}
 		}
 
-		m_ppu.Render(cyclesPassed, m_memory);
+		if (microStepping)
+		{
+			m_ppu.Update(cyclesPassed, m_memory);
+		}
 
 		bool shouldBreak = false;
+		bool pollingLoopArrival = false;
 		if (tCycleStep)
 		{
-			m_samplesGenerated += m_apu.Update(m_memory, MCYCLES_TO_CYCLES, m_turbospeed);
-			m_serial.Update(m_memory, 1);
-			shouldBreak = m_cpu.Step(m_memory);
+			shouldBreak = m_cpu.Step<instrumented>(m_memory);
+			pollingLoopArrival = m_cpu.TakePollingLoopArrival();
 		}
 
 		m_totalCycles += cyclesPassed;
-		double cycleDurationS = static_cast<double>((cyclesPassed)) / (static_cast<double>(CPU_FREQUENCY) * static_cast<double>(m_turbospeed));
-		m_stepDuration += cycleDurationS * 1000.0;
 
-		if (shouldBreak)
+		if (shouldBreak || (stopAtVBlank && m_ppu.GetCompletedFrames() != startFrame))
 		{
 			break;
 		}
+
+		if (!microStepping && m_cpu.IsWaitingForInterrupt(m_memory))
+		{
+			SkipHaltedCycles(tCycles);
+		}
+		else if (!microStepping && pollingLoopArrival)
+		{
+			SkipPollingLoop(tCycles);
+		}
+	}
+}
+
+template<bool microStepping>
+void VirtualMachine::RunDueEvents()
+{
+	// Same order as the components used to be ticked in every m-cycle
+	if (m_scheduler.IsDue(SchedulerEvent::DMA))
+	{
+		// The transfer writes OAM, a lagging PPU has to scan it first
+		m_ppu.SyncToPreviousCycle();
+		m_memory.Update();
+	}
+	if (m_scheduler.IsDue(SchedulerEvent::Joypad))
+	{
+		m_joypad.Update(m_memory);
+	}
+	if (m_scheduler.IsDue(SchedulerEvent::Timer))
+	{
+		m_clock.Update(m_memory);
+	}
+	if (!microStepping && m_scheduler.IsDue(SchedulerEvent::PPU))
+	{
+		m_ppu.Update(MCYCLES_TO_CYCLES, m_memory);
+	}
+	if (m_scheduler.IsDue(SchedulerEvent::Serial))
+	{
+		m_serial.Update(m_memory, 1);
+	}
+	if (m_scheduler.IsDue(SchedulerEvent::APU))
+	{
+		m_apu.Update();
+	}
+}
+
+// Nothing can change state before the next scheduled event wakes the CPU up,
+// so the halted m-cycles in between are skipped all at once
+void VirtualMachine::SkipHaltedCycles(uint64_t tCycles)
+{
+	uint64_t cycle = m_scheduler.GetCurrentCycle();
+	uint64_t wakeupCycle = m_scheduler.GetNextEventCycle();
+	if (cycle + 1 >= wakeupCycle || m_totalCycles >= tCycles)
+	{
+		return;
+	}
+
+	uint64_t skippedCycles = wakeupCycle - cycle - 1;
+	uint64_t budgetCycles = (tCycles - m_totalCycles + MCYCLES_TO_CYCLES - 1) / MCYCLES_TO_CYCLES;
+	if (budgetCycles < skippedCycles)
+	{
+		skippedCycles = budgetCycles;
+	}
+
+	m_scheduler.Advance(skippedCycles);
+	m_totalCycles += skippedCycles * MCYCLES_TO_CYCLES;
+}
+
+// The CPU arrived at the head of a polling loop whose last iteration neither changed a register nor saw a scheduled event.
+// Every iteration until the next event reads the same values, so whole iterations are skipped and the CPU ends up at the loop head as if it ran them.
+void VirtualMachine::SkipPollingLoop(uint64_t tCycles)
+{
+	uint64_t cycle = m_scheduler.GetCurrentCycle();
+	uint64_t nextEventCycle = m_scheduler.GetNextEventCycle();
+
+	// A PPU that is catching up changes the LCD registers without any scheduled event
+	if (m_cpu.IsPollingLoopRepeat() && !m_ppu.IsCatchingUp() && m_pollingLoopCycle < cycle && cycle < m_pollingLoopEventCycle && m_totalCycles < tCycles)
+	{
+		uint64_t iterationCycles = cycle - m_pollingLoopCycle;
+		uint64_t iterations = (nextEventCycle - cycle - 1) / iterationCycles;
+		uint64_t budgetIterations = (tCycles - m_totalCycles) / (iterationCycles * MCYCLES_TO_CYCLES);
+		if (budgetIterations < iterations)
+		{
+			iterations = budgetIterations;
+		}
+
+		uint64_t skippedCycles = iterations * iterationCycles;
+		m_scheduler.Advance(skippedCycles);
+		m_totalCycles += skippedCycles * MCYCLES_TO_CYCLES;
+		m_skippedPollingCycles += skippedCycles * MCYCLES_TO_CYCLES;
+		m_cpu.SkipPollingLoopIterations(iterations);
 	}
-	m_stepDuration -= deltaMs;
+
+	m_pollingLoopCycle = m_scheduler.GetCurrentCycle();
+	m_pollingLoopEventCycle = nextEventCycle;
+}
+
+// Brings the components that skip idle cycles up to the current cycle, e.g. before their state is observed
+void VirtualMachine::SyncComponents()
+{
+	m_clock.Sync();
+	m_ppu.Sync();
+	m_apu.Sync();
+}
+
+void VirtualMachine::ResetEvents()
+{
+	m_scheduler.ScheduleAll(m_scheduler.GetCurrentCycle() + 1);
+	m_clock.ResetSync();
+	m_ppu.ResetSync();
+	m_apu.ResetSync();
 }
 
 const void* VirtualMachine::GetFrameBuffer()
@@ -111,11 +316,26 @@ const void* VirtualMachine::GetFrameBuffer()
 	return m_ppu.GetFrameBuffer();
 }
 
+void VirtualMachine::SetFrameBuffer(void* buffer, uint32_t stride, EmulatorSettings::PixelFormat format)
+{
+	m_ppu.SetFrameBuffer(buffer, stride, format);
+}
+
+void VirtualMachine::SetFrameReadyCallback(FrameReadyCallback callback, void* userData)
+{
+	m_ppu.SetFrameReadyCallback(callback, userData);
+}
+
 uint32_t VirtualMachine::GetNumberOfGeneratedSamples()
 {
 	return m_samplesGenerated;
 }
 
+uint64_t VirtualMachine::GetSkippedPollingCycles()
+{
+	return m_skippedPollingCycles;
+}
+
 void VirtualMachine::SetLoggerCallback(LoggerCallback callback)
 {
 	Logger_Helpers::loggerCallback = callback;
@@ -133,11 +353,17 @@ void VirtualMachine::SetPersistentMemoryCallback(PersistentMemoryCallback callba
 
 SerializationView VirtualMachine::Serialize(bool rawData)
 {
+	SyncComponents();
 	return m_serializer.Serialize(m_memory.GetHeaderChecksum(), m_romName, rawData);
 }
 void VirtualMachine::Deserialize(const SerializationView& data)
 {
+	// The frame buffers aren't part of the save state, they keep whatever the PPU drew up to now
+	SyncComponents();
 	m_serializer.Deserialize(data, m_memory.GetHeaderChecksum());
+	// Bank registers and the bootrom mapping come from the save state
+	m_memory.RefreshPageTable();
+	ResetEvents();
 #if _DEBUG
 	m_cpu.DisassembleROM(m_memory);
 #endif
@@ -146,6 +372,27 @@ void VirtualMachine::Deserialize(const SerializationView& data)
 void VirtualMachine::SetTurboSpeed(float speed)
 {
 	m_turbospeed = speed;
+	m_apu.SetTurboSpeed(speed);
+}
+
+void VirtualMachine::SetAudioRateAdjustment(float ratio)
+{
+	m_apu.SetRateAdjustment(ratio);
+}
+
+void VirtualMachine::SetAudioEnabled(bool enabled)
+{
+	m_apu.SetEnabled(enabled);
+}
+
+void VirtualMachine::SetPPUAccuracy(EmulatorSettings::PPUAccuracy accuracy)
+{
+	m_ppu.SetAccuracy(accuracy);
+}
+
+void VirtualMachine::SetRenderInterval(uint32_t interval)
+{
+	m_ppu.SetRenderInterval(interval);
 }
 
 #if _DEBUG
@@ -190,6 +437,7 @@ Emulator::PPUState VirtualMachine::GetPPUState()
 
 void* VirtualMachine::GetRawMemoryView()
 {
+	SyncComponents();
 	return m_memory.GetRawMemoryView();
 }
 
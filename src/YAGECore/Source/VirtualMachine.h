@@ -9,11 +9,12 @@
 #include "Joypad.h"
 #include "Serial.h"
 #include "APU.h"
+#include "Scheduler.h"
 
 class VirtualMachine : public Emulator
 {
 public:
-	VirtualMachine();
+	explicit VirtualMachine(Allocator* allocator);
 	virtual ~VirtualMachine() override = default;
 
 	virtual void Load(const char* romName, const char* rom, uint32_t size) override;
@@ -25,8 +26,13 @@ public:
 	void SetAudioBuffer(float* buffer, uint32_t size, uint32_t sampleRate, uint32_t* startOffset) override;
 
 	virtual void Step(EmulatorInputs::InputState, double deltaMs, bool microStepping) override;
+	virtual uint64_t RunCycles(EmulatorInputs::InputState inputState, uint64_t tCycles) override;
+	virtual uint64_t RunUntilVBlank(EmulatorInputs::InputState inputState) override;
 	virtual const void* GetFrameBuffer() override;
+	virtual void SetFrameBuffer(void* buffer, uint32_t stride, EmulatorSettings::PixelFormat format) override;
+	virtual void SetFrameReadyCallback(FrameReadyCallback callback, void* userData) override;
 	uint32_t GetNumberOfGeneratedSamples() override;
+	uint64_t GetSkippedPollingCycles() override;
 
 	virtual void SetLoggerCallback(LoggerCallback callback) override;
 
@@ -34,6 +40,10 @@ public:
 	virtual void Deserialize(const SerializationView& data) override;
 
 	virtual void SetTurboSpeed(float speed) override;
+	virtual void SetAudioRateAdjustment(float ratio) override;
+	virtual void SetAudioEnabled(bool enabled) override;
+	virtual void SetPPUAccuracy(EmulatorSettings::PPUAccuracy accuracy) override;
+	virtual void SetRenderInterval(uint32_t interval) override;
 
 #if _DEBUG
 	virtual void SetInstructionCallback(uint8_t instr, Emulator::DebugCallback callback, void* userData) override;
@@ -54,7 +64,18 @@ public:
 	Registers& GetRegisters();
 #endif
 private:
+	uint64_t Run(EmulatorInputs::InputState inputState, uint64_t tCycles, bool microStepping, bool stopAtVBlank);
+	template<bool microStepping, bool instrumented>
+	void RunLoop(uint64_t tCycles, bool stopAtVBlank);
+	template<bool microStepping>
+	void RunDueEvents();
+	void SkipHaltedCycles(uint64_t tCycles);
+	void SkipPollingLoop(uint64_t tCycles);
+	void SyncComponents();
+	void ResetEvents();
+
 	GamestateSerializer m_serializer;
+	Scheduler m_scheduler;
 	Memory m_memory;
 	CPU m_cpu;
 	Timer m_clock;
@@ -67,6 +88,9 @@ private:
 	uint64_t m_totalCycles;
 	uint32_t m_samplesGenerated;
 	uint32_t m_tCyclesStepped;
+	uint64_t m_skippedPollingCycles;
+	uint64_t m_pollingLoopCycle;
+	uint64_t m_pollingLoopEventCycle;
 	bool m_frameRendered;
 	double m_stepDuration;
 	float m_turbospeed;
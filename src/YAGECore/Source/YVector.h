@@ -7,18 +7,20 @@ template<typename T>
 class yVector
 {
 public:
-	yVector()
+	explicit yVector(Allocator* allocator)
+		: m_allocator(allocator)
 	{
 	}
 
-	yVector(uint32_t size)
+	yVector(Allocator* allocator, uint32_t size)
+		: m_allocator(allocator)
 	{
 		reserve(size);
 	}
 
 	~yVector()
 	{
-		Y_DELETE_A(m_buffer);
+		Y_DELETE_A(m_allocator, m_buffer);
 	}
 
 	yVector(const yVector& other) = delete;
@@ -60,7 +62,7 @@ public:
 			LOG_ERROR("Trying to allocate yVector more than once");
 			return;
 		}
-		m_buffer = Y_NEW_A(T, size);
+		m_buffer = Y_NEW_A(m_allocator, T, size);
 		m_reservedSize = size;
 	}
 
@@ -70,6 +72,7 @@ public:
 	}
 
 private:
+	Allocator* m_allocator;
 	T* m_buffer{ nullptr };
 	uint32_t m_reservedSize{ 0 };
 	uint32_t m_count{ 0 };
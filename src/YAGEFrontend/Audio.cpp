@@ -77,3 +77,28 @@ void Audio::ResetFramesConsumed()
 {
 	return m_backend.ResetFramesConsumed();
 }
+
+void Audio::Submit(uint32_t generatedFrames)
+{
+	m_backend.Submit(generatedFrames);
+}
+
+float Audio::GetRateAdjustment()
+{
+	return m_backend.GetRateAdjustment();
+}
+
+float Audio::GetLatencyMs()
+{
+	return m_backend.GetLatencyMs();
+}
+
+uint32_t Audio::GetUnderruns()
+{
+	return m_backend.GetUnderruns();
+}
+
+uint32_t Audio::GetOverruns()
+{
+	return m_backend.GetOverruns();
+}
@@ -42,6 +42,12 @@ public:
 	uint32_t GetFramesConsumed();
 	void ResetFramesConsumed();
 
+	void Submit(uint32_t generatedFrames);
+	float GetRateAdjustment();
+	float GetLatencyMs();
+	uint32_t GetUnderruns();
+	uint32_t GetOverruns();
+
 private:
 	AudioBackend m_backend;
 	AudioState m_state;
@@ -2,12 +2,17 @@
 #include <stdio.h>
 #include <iostream>
 
-#define NUM_SECONDS 4
 #define SAMPLE_RATE 48000
 #define BUFFER_SIZE_SECONDS 1
-#define PLAYBACK_OFFSET_MS 0
+#define FRAMES_PER_CALLBACK 256
 
-#define AUDIO_DEBUG 1
+#define QUEUE_SIZE_MS 250
+#define TARGET_LATENCY_MS 50
+#define TARGET_LATENCY_FRAMES (SAMPLE_RATE * TARGET_LATENCY_MS / 1000)
+// Far below what anyone hears as a change in pitch, but a lot more than the clocks drift apart
+#define MAX_RATE_ADJUSTMENT 0.005f
+// The fill level jumps with every step & callback, the rate control follows its average instead
+#define FILL_LEVEL_SMOOTHING 0.05f
 
 /* This routine will be called by the PortAudio engine when audio is needed.
  * It may called at interrupt level on some machines so don't do anything
@@ -17,8 +22,15 @@
 void AudioPortaudio::Init()
 {
     m_buffer = new float[GetAudioBufferSize()]();
-    m_writePosition = static_cast<uint32_t>((static_cast<float>(SAMPLE_RATE) / 1000.0f) * PLAYBACK_OFFSET_MS);
-    m_playbackPosition = 0;
+    m_writePosition = 0;
+    m_queue.Init(SAMPLE_RATE * QUEUE_SIZE_MS / 1000);
+
+    m_volume = 1.0f;
+    m_averageFillLevel = 0.0f;
+    m_isBuffering = true;
+    m_framesConsumed = 0;
+    m_underruns = 0;
+    m_overruns = 0;
 
 
     PaError err;
@@ -36,7 +48,7 @@ void AudioPortaudio::Init()
         2,          /* stereo output */
         paFloat32,  /* 32 bit floating point output */
         SAMPLE_RATE,
-        256,        /* frames per buffer */
+        FRAMES_PER_CALLBACK,
         paCallback,
         this);
     if (err != paNoError)
@@ -62,6 +74,7 @@ void AudioPortaudio::Terminate()
         return;
     }
     Pa_Terminate();
+    m_queue.Terminate();
     delete[] m_buffer;
 }
 
@@ -120,6 +133,42 @@ void AudioPortaudio::ResetFramesConsumed()
     m_framesConsumed = 0;
 }
 
+void AudioPortaudio::Submit(uint32_t generatedFrames)
+{
+    uint32_t frames = m_writePosition / 2;
+    // The emulator wraps around to the start of the staging buffer once it is full, only the frames after the last wrap are left
+    bool hasWrapped = generatedFrames > frames;
+    if (m_queue.Write(m_buffer, frames) < frames || hasWrapped)
+    {
+        m_overruns++;
+    }
+    m_writePosition = 0;
+
+    m_averageFillLevel += (static_cast<float>(m_queue.GetFillLevel()) - m_averageFillLevel) * FILL_LEVEL_SMOOTHING;
+}
+
+float AudioPortaudio::GetRateAdjustment()
+{
+    float error = (static_cast<float>(TARGET_LATENCY_FRAMES) - m_averageFillLevel) / static_cast<float>(TARGET_LATENCY_FRAMES);
+    error = error > 1.0f ? 1.0f : (error < -1.0f ? -1.0f : error);
+    return 1.0f + MAX_RATE_ADJUSTMENT * error;
+}
+
+float AudioPortaudio::GetLatencyMs()
+{
+    return m_averageFillLevel * 1000.0f / static_cast<float>(SAMPLE_RATE);
+}
+
+uint32_t AudioPortaudio::GetUnderruns()
+{
+    return m_underruns;
+}
+
+uint32_t AudioPortaudio::GetOverruns()
+{
+    return m_overruns;
+}
+
 void AudioPortaudio::ErrorHandler(PaError err)
 {
     //TODO use logger
@@ -134,48 +183,36 @@ int AudioPortaudio::paCallback(const void* inputBuffer, void* outputBuffer, unsi
     /* Cast data passed through stream to our structure. */
     AudioPortaudio* data = (AudioPortaudio*)userData;
     float* out = (float*)outputBuffer;
-    unsigned int i;
     (void)inputBuffer; /* Prevent unused variable warning. */
 
-    for (i = 0; i < framesPerBuffer; i++)
-    {
-        data->m_framesConsumed++;
-
-        if (data->m_playbackPosition == data->m_writePosition)
-        {
-            //fprintf(stderr, "Playback running ahead of audio generation\n");
-            *out++ = 0;
-            *out++ = 0;
-            continue;
-        }
-        float* left = data->m_buffer + data->m_playbackPosition++;
-        float* right = data->m_buffer + data->m_playbackPosition++;
-
-        //scale down audio volume
-        *left *= data->m_volume;
-        *right *= data->m_volume;
-
-
-        *out++ = *left;
-        *out++ = *right;
+    uint32_t frames = static_cast<uint32_t>(framesPerBuffer);
+    data->m_framesConsumed += frames;
 
-#if AUDIO_DEBUG
-       
-        *left = 0;
-        *right = 0;
+    if (data->m_isBuffering && data->m_queue.GetFillLevel() >= TARGET_LATENCY_FRAMES / 2)
+    {
+        data->m_isBuffering = false;
+    }
 
-        if (data->m_playbackPosition == data->m_writePosition + 2)
+    uint32_t framesRead = 0;
+    if (!data->m_isBuffering)
+    {
+        framesRead = data->m_queue.Read(out, frames);
+        if (framesRead < frames)
         {
-            fprintf(stderr, "Playback running ahead of audio generation\n");
+            // Playback ran ahead of the emulation, wait for some headroom instead of crackling on every callback
+            data->m_underruns++;
+            data->m_isBuffering = true;
         }
-        uint32_t buffSize = data->GetAudioBufferSize();
-        //std::cout << "Dist: " << (data->m_writePosition + buffSize - data->m_playbackPosition) % buffSize<< std::endl;
+    }
 
-#endif
-        if (data->m_playbackPosition >= data->GetAudioBufferSize())
-        {
-            data->m_playbackPosition = 0;
-        }
+    float volume = data->m_volume;
+    for (uint32_t i = 0; i < framesRead * 2; i++)
+    {
+        out[i] *= volume;
+    }
+    for (uint32_t i = framesRead * 2; i < frames * 2; i++)
+    {
+        out[i] = 0.0f;
     }
     return 0;
 }
@@ -1,5 +1,7 @@
 #pragma once
 #include "portaudio.h"
+#include "AudioRingBuffer.h"
+#include <atomic>
 #include <cstdint>
 
 class AudioPortaudio
@@ -19,15 +21,32 @@ public:
 
 	uint32_t GetFramesConsumed();
 	void ResetFramesConsumed();
+
+	// Moves everything the emulator wrote since the last call into the queue the audio callback plays from.
+	// Frames generated beyond what the staging buffer holds got overwritten by the emulator & count as an overrun
+	void Submit(uint32_t generatedFrames);
+	// Ratio to generate samples at, nudges the queue towards the target latency
+	float GetRateAdjustment();
+
+	float GetLatencyMs();
+	uint32_t GetUnderruns();
+	uint32_t GetOverruns();
 private:
+	// The emulator writes into this one from the start on every step, it never gets read by the audio callback
 	float* m_buffer;
 	uint32_t m_writePosition;
-	uint32_t m_playbackPosition;
+	AudioRingBuffer m_queue;
 	PaStream* m_stream;
 
-	float m_volume;
+	std::atomic<float> m_volume;
+
+	float m_averageFillLevel;
+	// Only touched by the audio callback, plays silence until the queue is filled up to the target latency again
+	bool m_isBuffering;
 
-	uint32_t m_framesConsumed;
+	std::atomic<uint32_t> m_framesConsumed;
+	std::atomic<uint32_t> m_underruns;
+	std::atomic<uint32_t> m_overruns;
 
 	void ErrorHandler(PaError err);
 
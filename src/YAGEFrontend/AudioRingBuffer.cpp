@@ -0,0 +1,80 @@
+#include "AudioRingBuffer.h"
+#include <cstring>
+
+#define CHANNELS 2
+
+AudioRingBuffer::AudioRingBuffer() :
+    m_buffer(nullptr)
+    , m_capacity(0)
+    , m_readIndex(0)
+    , m_writeIndex(0)
+{
+}
+
+void AudioRingBuffer::Init(uint32_t capacityFrames)
+{
+    m_capacity = 1;
+    while (m_capacity < capacityFrames)
+    {
+        m_capacity <<= 1;
+    }
+
+    m_buffer = new float[m_capacity * CHANNELS]();
+    m_readIndex.store(0, std::memory_order_relaxed);
+    m_writeIndex.store(0, std::memory_order_relaxed);
+}
+
+void AudioRingBuffer::Terminate()
+{
+    delete[] m_buffer;
+    m_buffer = nullptr;
+    m_capacity = 0;
+}
+
+uint32_t AudioRingBuffer::Write(const float* frames, uint32_t count)
+{
+    uint32_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    // Acquire, so the consumer is done with the frames it released before they get overwritten
+    uint32_t readIndex = m_readIndex.load(std::memory_order_acquire);
+
+    uint32_t freeFrames = m_capacity - (writeIndex - readIndex);
+    count = count < freeFrames ? count : freeFrames;
+
+    uint32_t start = writeIndex & (m_capacity - 1);
+    uint32_t firstPart = m_capacity - start < count ? m_capacity - start : count;
+    memcpy(m_buffer + start * CHANNELS, frames, firstPart * CHANNELS * sizeof(float));
+    memcpy(m_buffer, frames + firstPart * CHANNELS, (count - firstPart) * CHANNELS * sizeof(float));
+
+    // Release, so the frames are visible to the consumer before the index that hands them over
+    m_writeIndex.store(writeIndex + count, std::memory_order_release);
+    return count;
+}
+
+uint32_t AudioRingBuffer::Read(float* frames, uint32_t count)
+{
+    uint32_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+    uint32_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+
+    uint32_t availableFrames = writeIndex - readIndex;
+    count = count < availableFrames ? count : availableFrames;
+
+    uint32_t start = readIndex & (m_capacity - 1);
+    uint32_t firstPart = m_capacity - start < count ? m_capacity - start : count;
+    memcpy(frames, m_buffer + start * CHANNELS, firstPart * CHANNELS * sizeof(float));
+    memcpy(frames + firstPart * CHANNELS, m_buffer, (count - firstPart) * CHANNELS * sizeof(float));
+
+    m_readIndex.store(readIndex + count, std::memory_order_release);
+    return count;
+}
+
+uint32_t AudioRingBuffer::GetFillLevel() const
+{
+    uint32_t readIndex = m_readIndex.load(std::memory_order_acquire);
+    uint32_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+    return writeIndex - readIndex;
+}
+
+uint32_t AudioRingBuffer::GetCapacity() const
+{
+    return m_capacity;
+}
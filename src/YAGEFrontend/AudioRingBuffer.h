@@ -0,0 +1,34 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Queue of interleaved stereo frames between exactly one producer, the emulation thread, and one consumer, the audio callback.
+// Each side only ever moves its own index forward, so neither of them has to wait for the other.
+class AudioRingBuffer
+{
+public:
+	AudioRingBuffer();
+
+	// The capacity gets rounded up to a power of two
+	void Init(uint32_t capacityFrames);
+	void Terminate();
+
+	// Producer side, returns how many of the frames fit. The rest is dropped
+	uint32_t Write(const float* frames, uint32_t count);
+	// Consumer side, returns how many frames were read
+	uint32_t Read(float* frames, uint32_t count);
+
+	// Frames written but not read yet. The other side can only have moved it in its own direction since
+	uint32_t GetFillLevel() const;
+	uint32_t GetCapacity() const;
+
+private:
+	float* m_buffer;
+	uint32_t m_capacity;
+
+	// Both count up and wrap around at 2^32, the capacity divides that so their difference is always the fill level.
+	// Kept on separate cache lines so the two threads don't keep invalidating each other's
+	alignas(64) std::atomic<uint32_t> m_readIndex;
+	alignas(64) std::atomic<uint32_t> m_writeIndex;
+};
+
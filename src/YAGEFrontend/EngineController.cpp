@@ -24,9 +24,12 @@ void DumpMemory(void* userData)
 }
 #endif
 
-void GatherStats(Emulator& emulator, EngineData& state)
+void GatherStats(Emulator& emulator, Audio& audio, EngineData& state)
 {
     state.m_stats.m_allocatedMemory = emulator.GetMemoryUse();
+    state.m_stats.m_audioLatencyMs = audio.GetLatencyMs();
+    state.m_stats.m_audioUnderruns = audio.GetUnderruns();
+    state.m_stats.m_audioOverruns = audio.GetOverruns();
 #if defined (_DEBUG)
     state.m_gameData.m_debuggerState.m_cpuStatePrevious = state.m_gameData.m_debuggerState.m_cpuState;
     state.m_gameData.m_debuggerState.m_cpuState = emulator.GetCPUState();
@@ -241,7 +244,12 @@ void EngineController::RunEmulatorLoop()
 
 			if(shouldStep)
 			{
-                m_emulator->SetTurboSpeed(m_data.m_turbo ? m_data.m_userSettings.m_systemTurboSpeed.GetValue() : 1.0f);
+                float turboSpeed = m_data.m_turbo ? m_data.m_userSettings.m_systemTurboSpeed.GetValue() : 1.0f;
+                m_emulator->SetTurboSpeed(turboSpeed);
+                m_emulator->SetPPUAccuracy(m_data.m_userSettings.m_graphicsScanlineRenderer.GetValue() ? EmulatorSettings::PPUAccuracy::Scanline : EmulatorSettings::PPUAccuracy::PixelFIFO);
+                // Only the last frame of a step gets presented, in turbo most of the others don't need to be drawn
+                bool skipFrames = m_data.m_userSettings.m_graphicsTurboFrameSkip.GetValue() && turboSpeed > 1.0f;
+                m_emulator->SetRenderInterval(skipFrames ? static_cast<uint32_t>(turboSpeed) : 1);
 
                 if (m_data.m_gameData.m_debuggerState.m_triggerDebugBreak)
                 {
@@ -251,6 +259,8 @@ void EngineController::RunEmulatorLoop()
 
                 m_emulator->Step(inputState, emulatorDeltaMs, microstep);
                 frameBuffer = m_emulator->GetFrameBuffer();
+                m_audio->Submit(m_emulator->GetNumberOfGeneratedSamples());
+                m_emulator->SetAudioRateAdjustment(m_audio->GetRateAdjustment());
                 m_audio->Play();
 
                 frameCount++;
@@ -268,7 +278,7 @@ void EngineController::RunEmulatorLoop()
 
             if(shouldStep || m_data.m_gameData.m_debuggerState.m_forceGatherStats)
             {
-                GatherStats(*m_emulator, m_data);
+                GatherStats(*m_emulator, *m_audio, m_data);
                 m_data.m_gameData.m_debuggerState.m_forceGatherStats = false;
             }
 
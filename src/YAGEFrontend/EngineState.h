@@ -217,6 +217,8 @@ public:
 	ConfigurableValue<std::string> m_systemBootromPath;
 	ConfigurableValue<float> m_systemTurboSpeed;
 	ConfigurableValue<uint32_t> m_graphicsScalingFactor;
+	ConfigurableValue<bool> m_graphicsScanlineRenderer;
+	ConfigurableValue<bool> m_graphicsTurboFrameSkip;
 	ConfigurableValue<float> m_audioVolume;
 	std::vector<ConfigurableValue<std::string>> m_recentFiles;
 	std::vector<ConfigurableValue<uint32_t>> m_keyBindings;
@@ -269,6 +271,9 @@ struct KeyBindRequest
 struct Stats
 {
 	uint32_t m_allocatedMemory = 0;
+	float m_audioLatencyMs = 0.0f;
+	uint32_t m_audioUnderruns = 0;
+	uint32_t m_audioOverruns = 0;
 };
 
 struct DebuggerState
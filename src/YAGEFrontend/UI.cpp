@@ -186,6 +186,9 @@ namespace
             ImGui::Text(std::to_string(data.m_stats.m_allocatedMemory).c_str());
 
             ImGui::Text("Frametime: % .2f", data.m_gameData.m_debuggerState.m_frameDeltaMs);
+            ImGui::Text("Audio latency: % .1f ms", data.m_stats.m_audioLatencyMs);
+            ImGui::Text("Audio underruns: %u", data.m_stats.m_audioUnderruns);
+            ImGui::Text("Audio overruns: %u", data.m_stats.m_audioOverruns);
             ImGui::End();
         }
     }
@@ -253,6 +256,14 @@ namespace
 
             ImGui::LabelText("##", "%sx%s",FileParser::ToString(data.m_baseWidth * scale).c_str(), FileParser::ToString(data.m_baseHeight * scale).c_str());
 
+            bool scanlineRenderer = data.m_userSettings.m_graphicsScanlineRenderer.GetValue();
+            ImGui::Checkbox("Scanline Renderer", &scanlineRenderer);
+            data.m_userSettings.m_graphicsScanlineRenderer.SetValue(scanlineRenderer);
+
+            bool turboFrameSkip = data.m_userSettings.m_graphicsTurboFrameSkip.GetValue();
+            ImGui::Checkbox("Skip Frames In Turbo", &turboFrameSkip);
+            data.m_userSettings.m_graphicsTurboFrameSkip.SetValue(turboFrameSkip);
+
             if (ImGui::Button("Save", ImVec2(120, 0)))
             {
                 data.m_userSettings.Save();
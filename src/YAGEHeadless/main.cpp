@@ -0,0 +1,251 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Emulator.h"
+#include "CommandLineArguments.h"
+
+#define DEFAULT_FRAME_COUNT 3600
+#define BYTES_PER_PIXEL 4
+// Frames at the end of the run that are always drawn, one of them completes in full whatever the render interval skipped before
+#define FINAL_DRAWN_FRAMES 2
+
+namespace
+{
+	void* AllocFunc(uint32_t size)
+	{
+		return new uint8_t[size];
+	}
+
+	void FreeFunc(void* ptr)
+	{
+		delete[] static_cast<uint8_t*>(ptr);
+	}
+
+	void LogMessage(const char* message, uint8_t severity)
+	{
+		// Only forward warnings and errors, info messages would dominate the runtime
+		if (severity > 0)
+		{
+			fprintf(stderr, "%s", message);
+		}
+	}
+
+	bool ReadFile(const std::string& path, std::vector<char>& blob)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		std::streamsize size = file.tellg();
+		file.seekg(0, std::ios::beg);
+		blob.resize(static_cast<size_t>(size));
+		return static_cast<bool>(file.read(blob.data(), size));
+	}
+
+	bool WriteFile(const std::string& path, const void* data, size_t size)
+	{
+		std::ofstream file(path, std::ios::binary);
+		if (!file.is_open())
+		{
+			return false;
+		}
+		file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+		return static_cast<bool>(file);
+	}
+
+	// Binary PPM, readable by pretty much every image tool without extra dependencies
+	bool WriteFramebuffer(const std::string& path, const void* frameBuffer)
+	{
+		const uint8_t* rgba = static_cast<const uint8_t*>(frameBuffer);
+		std::string header = "P6\n" + std::to_string(EmulatorConstants::SCREEN_WIDTH) + " " + std::to_string(EmulatorConstants::SCREEN_HEIGHT) + "\n255\n";
+
+		std::vector<uint8_t> image(header.begin(), header.end());
+		image.reserve(header.size() + EmulatorConstants::SCREEN_SIZE * 3);
+		for (uint32_t i = 0; i < EmulatorConstants::SCREEN_SIZE; ++i)
+		{
+			image.push_back(rgba[i * BYTES_PER_PIXEL + 0]);
+			image.push_back(rgba[i * BYTES_PER_PIXEL + 1]);
+			image.push_back(rgba[i * BYTES_PER_PIXEL + 2]);
+		}
+		return WriteFile(path, image.data(), image.size());
+	}
+
+	void PrintUsage()
+	{
+		printf("Usage: YAGEHeadless -rom=<path> [options]\n");
+		printf("  -bootrom=<path>      Boot from the given bootrom\n");
+		printf("  -sav=<path>          Load persistent cartridge memory\n");
+		printf("  -frames=<n>          Number of frames to run (default %u)\n", DEFAULT_FRAME_COUNT);
+		printf("  -cycles=<n>          Number of t-cycles to run, overrides -frames\n");
+		printf("  -framebuffer=<path>  Dump the final framebuffer as PPM\n");
+		printf("  -savestate=<path>    Dump a save state after the run\n");
+		printf("  -ppu=<fifo|scanline> PPU accuracy (default fifo)\n");
+		printf("  -render=<n>          Only draw every nth frame, 0 draws none (default 1). The last frames are always drawn with -framebuffer\n");
+	}
+}
+
+int main(int argc, char** argv)
+{
+	CommandLineParser parser(argc, argv);
+
+	std::string romPath = parser.GetArgument("rom");
+	if (romPath.empty())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::vector<char> romBlob;
+	if (!ReadFile(romPath, romBlob))
+	{
+		fprintf(stderr, "Could not read rom %s\n", romPath.c_str());
+		return 1;
+	}
+
+	std::vector<char> bootromBlob;
+	if (parser.HasArgument("bootrom") && !ReadFile(parser.GetArgument("bootrom"), bootromBlob))
+	{
+		fprintf(stderr, "Could not read bootrom %s\n", parser.GetArgument("bootrom").c_str());
+		return 1;
+	}
+
+	std::vector<char> ramBlob;
+	if (parser.HasArgument("sav") && !ReadFile(parser.GetArgument("sav"), ramBlob))
+	{
+		fprintf(stderr, "Could not read save file %s\n", parser.GetArgument("sav").c_str());
+		return 1;
+	}
+
+	uint32_t renderInterval = 1;
+	if (parser.HasArgument("render"))
+	{
+		renderInterval = static_cast<uint32_t>(strtoul(parser.GetArgument("render").c_str(), nullptr, 10));
+	}
+
+	const bool dumpFramebuffer = parser.HasArgument("framebuffer");
+	if (dumpFramebuffer && renderInterval == 0)
+	{
+		fprintf(stderr, "-framebuffer needs frames to be drawn, it can't be combined with -render=0\n");
+		return 1;
+	}
+
+	uint64_t tCycles = static_cast<uint64_t>(DEFAULT_FRAME_COUNT) * EmulatorConstants::TCYCLES_PER_FRAME;
+	if (parser.HasArgument("cycles"))
+	{
+		tCycles = strtoull(parser.GetArgument("cycles").c_str(), nullptr, 10);
+	}
+	else if (parser.HasArgument("frames"))
+	{
+		tCycles = strtoull(parser.GetArgument("frames").c_str(), nullptr, 10) * EmulatorConstants::TCYCLES_PER_FRAME;
+	}
+
+	Emulator* emulator = Emulator::Create(&AllocFunc, &FreeFunc);
+	emulator->SetLoggerCallback(&LogMessage);
+
+	if (parser.HasArgument("ppu"))
+	{
+		std::string accuracy = parser.GetArgument("ppu");
+		if (accuracy == "scanline")
+		{
+			emulator->SetPPUAccuracy(EmulatorSettings::PPUAccuracy::Scanline);
+		}
+		else if (accuracy != "fifo")
+		{
+			fprintf(stderr, "Unknown PPU accuracy %s\n", accuracy.c_str());
+			Emulator::Delete(emulator);
+			return 1;
+		}
+	}
+
+	// Nobody listens to a headless run
+	emulator->SetAudioEnabled(false);
+
+	emulator->SetRenderInterval(renderInterval);
+
+	if (!bootromBlob.empty())
+	{
+		emulator->Load(romPath.c_str(), romBlob.data(), static_cast<uint32_t>(romBlob.size()), bootromBlob.data(), static_cast<uint32_t>(bootromBlob.size()));
+	}
+	else
+	{
+		emulator->Load(romPath.c_str(), romBlob.data(), static_cast<uint32_t>(romBlob.size()));
+	}
+
+	if (!ramBlob.empty())
+	{
+		emulator->LoadPersistentMemory(ramBlob.data(), static_cast<uint32_t>(ramBlob.size()));
+	}
+
+	// Step one emulated frame at a time without any pacing, the remainder is stepped at the end
+	EmulatorInputs::InputState inputState;
+	const uint64_t frameCount = tCycles / EmulatorConstants::TCYCLES_PER_FRAME;
+	const uint64_t remainingCycles = tCycles % EmulatorConstants::TCYCLES_PER_FRAME;
+
+	// The dumped frame must not be a skipped one, drawing is turned back on for the last frames of the run
+	const bool drawFinalFrames = dumpFramebuffer && renderInterval != 1;
+	const uint64_t firstDrawnFrame = frameCount > FINAL_DRAWN_FRAMES ? frameCount - FINAL_DRAWN_FRAMES : 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (uint64_t i = 0; i < frameCount; ++i)
+	{
+		if (drawFinalFrames && i == firstDrawnFrame)
+		{
+			emulator->SetRenderInterval(1);
+		}
+		emulator->RunCycles(inputState, EmulatorConstants::TCYCLES_PER_FRAME);
+	}
+	if (remainingCycles > 0)
+	{
+		emulator->RunCycles(inputState, remainingCycles);
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	double hostSeconds = std::chrono::duration<double>(end - start).count();
+	double emulatedFrames = static_cast<double>(tCycles) / EmulatorConstants::TCYCLES_PER_FRAME;
+	double emulatedSeconds = static_cast<double>(tCycles) * EMULATOR_CLOCK_MS / 1000.0;
+
+	printf("ROM:              %s\n", romPath.c_str());
+	printf("T-cycles:         %llu\n", static_cast<unsigned long long>(tCycles));
+	printf("Frames:           %.2f\n", emulatedFrames);
+	printf("Host time:        %.3f s\n", hostSeconds);
+	if (hostSeconds > 0.0)
+	{
+		printf("Emulated FPS:     %.2f\n", emulatedFrames / hostSeconds);
+		printf("Effective MHz:    %.3f\n", static_cast<double>(tCycles) / hostSeconds / 1000000.0);
+		printf("Speed:            %.2fx\n", emulatedSeconds / hostSeconds);
+	}
+	if (emulatedFrames > 0.0)
+	{
+		printf("Host ms/frame:    %.4f\n", hostSeconds * 1000.0 / emulatedFrames);
+	}
+	if (tCycles > 0)
+	{
+		uint64_t skippedCycles = emulator->GetSkippedPollingCycles();
+		printf("Polling skipped:  %llu t-cycles (%.2f%%)\n", static_cast<unsigned long long>(skippedCycles), static_cast<double>(skippedCycles) * 100.0 / static_cast<double>(tCycles));
+	}
+
+	int result = 0;
+	if (dumpFramebuffer && !WriteFramebuffer(parser.GetArgument("framebuffer"), emulator->GetFrameBuffer()))
+	{
+		fprintf(stderr, "Could not write framebuffer %s\n", parser.GetArgument("framebuffer").c_str());
+		result = 1;
+	}
+
+	if (parser.HasArgument("savestate"))
+	{
+		SerializationView savedState = emulator->Serialize(false);
+		if (!WriteFile(parser.GetArgument("savestate"), savedState.data, savedState.size))
+		{
+			fprintf(stderr, "Could not write save state %s\n", parser.GetArgument("savestate").c_str());
+			result = 1;
+		}
+	}
+
+	Emulator::Delete(emulator);
+	return result;
+}
@@ -204,7 +204,7 @@ export fn main() void {
     };
 
     while (true) {
-        cpp.Step(emu, input_state, 16.6666);
+        _ = cpp.RunUntilVBlank(emu, input_state);
 
         const raw = cpp.GetFrameBuffer(emu);
 